@@ -4,6 +4,7 @@ using Sharpmake;
 
 [module: Sharpmake.Include(@"Mimax\Mimax.sharpmake.cs")]
 [module: Sharpmake.Include(@"Mimax_Test\Mimax_Test.sharpmake.cs")]
+[module: Sharpmake.Include(@"Mimax_Benchmark\Mimax_Benchmark.sharpmake.cs")]
 [module: Sharpmake.Include(@"Sharpmake\Common.sharpmake.cs")]
 
 [Generate]
@@ -22,6 +23,7 @@ public class MimaxSolution : CommonSolution
 
         conf.AddProject<MimaxProject>(target);
         conf.AddProject<MimaxTestProject>(target);
+        conf.AddProject<MimaxBenchmarkProject>(target);
         
         conf.SetStartupProject<MimaxTestProject>();
     }
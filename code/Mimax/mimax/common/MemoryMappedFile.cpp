@@ -0,0 +1,127 @@
+#include "Mimax_PCH.h"
+#include "mimax/common/MemoryMappedFile.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+namespace mimax {
+namespace common {
+
+#ifdef _WIN32
+
+    CMemoryMappedFile::CMemoryMappedFile()
+        : m_data(nullptr)
+        , m_size(0)
+        , m_fileHandle(INVALID_HANDLE_VALUE)
+        , m_mappingHandle(nullptr)
+    {}
+
+    bool CMemoryMappedFile::Open(std::string const& path)
+    {
+        Close();
+
+        m_fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (m_fileHandle == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(m_fileHandle, &fileSize) || fileSize.QuadPart == 0)
+        {
+            Close();
+            return false;
+        }
+
+        m_mappingHandle = CreateFileMappingA(m_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_mappingHandle == nullptr)
+        {
+            Close();
+            return false;
+        }
+
+        m_data = static_cast<unsigned char const*>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (m_data == nullptr)
+        {
+            Close();
+            return false;
+        }
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void CMemoryMappedFile::Close()
+    {
+        if (m_data != nullptr)
+            UnmapViewOfFile(m_data);
+        if (m_mappingHandle != nullptr)
+            CloseHandle(m_mappingHandle);
+        if (m_fileHandle != INVALID_HANDLE_VALUE)
+            CloseHandle(m_fileHandle);
+
+        m_data = nullptr;
+        m_size = 0;
+        m_mappingHandle = nullptr;
+        m_fileHandle = INVALID_HANDLE_VALUE;
+    }
+
+#else
+
+    CMemoryMappedFile::CMemoryMappedFile()
+        : m_data(nullptr)
+        , m_size(0)
+        , m_fileDescriptor(-1)
+    {}
+
+    bool CMemoryMappedFile::Open(std::string const& path)
+    {
+        Close();
+
+        m_fileDescriptor = open(path.c_str(), O_RDONLY);
+        if (m_fileDescriptor < 0)
+            return false;
+
+        struct stat fileStat;
+        if (fstat(m_fileDescriptor, &fileStat) != 0 || fileStat.st_size == 0)
+        {
+            Close();
+            return false;
+        }
+
+        void* const data = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, m_fileDescriptor, 0);
+        if (data == MAP_FAILED)
+        {
+            Close();
+            return false;
+        }
+        m_data = static_cast<unsigned char const*>(data);
+        m_size = static_cast<size_t>(fileStat.st_size);
+        return true;
+    }
+
+    void CMemoryMappedFile::Close()
+    {
+        if (m_data != nullptr)
+            munmap(const_cast<unsigned char*>(m_data), m_size);
+        if (m_fileDescriptor >= 0)
+            close(m_fileDescriptor);
+
+        m_data = nullptr;
+        m_size = 0;
+        m_fileDescriptor = -1;
+    }
+
+#endif // _WIN32
+
+    CMemoryMappedFile::~CMemoryMappedFile()
+    {
+        Close();
+    }
+
+}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace mimax {
+namespace common {
+
+// Read-only view of a whole file mapped into memory, the pages are loaded by the OS on first access.
+class CMemoryMappedFile
+{
+public:
+    CMemoryMappedFile();
+    ~CMemoryMappedFile();
+
+    CMemoryMappedFile(CMemoryMappedFile const&) = delete;
+    CMemoryMappedFile& operator=(CMemoryMappedFile const&) = delete;
+
+    // closes the previously opened file, returns false if the file can't be mapped
+    bool Open(std::string const& path);
+    void Close();
+
+    inline bool IsOpen() const { return m_data != nullptr; }
+    inline unsigned char const* GetData() const { return m_data; }
+    inline size_t GetSize() const { return m_size; }
+
+private:
+    unsigned char const* m_data;
+    size_t m_size;
+#ifdef _WIN32
+    void* m_fileHandle;
+    void* m_mappingHandle;
+#else
+    int m_fileDescriptor;
+#endif // _WIN32
+};
+
+}
+}
@@ -0,0 +1,20 @@
+#include "Mimax_PCH.h"
+#include "mimax/common/ZobristKeys.h"
+
+#include <random>
+
+namespace mimax {
+namespace common {
+
+    CZobristKeys::CZobristKeys(size_t const keysCnt, unsigned long long const randomSeed)
+        : m_keys(keysCnt)
+    {
+        std::mt19937_64 randomEngine(randomSeed);
+        for (auto& key : m_keys)
+        {
+            key = randomEngine();
+        }
+    }
+
+}
+}
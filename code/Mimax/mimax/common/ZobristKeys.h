@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace mimax {
+namespace common {
+
+// Table of random 64-bit keys: the hash of a state is the XOR of the keys of its features,
+// so MakeMove can update it incrementally by XOR-ing out removed and XOR-ing in added features.
+class CZobristKeys
+{
+public:
+    CZobristKeys(size_t const keysCnt, unsigned long long const randomSeed);
+
+    inline uint64_t GetKey(size_t const index) const { return m_keys[index]; }
+    inline size_t GetKeysCount() const { return m_keys.size(); }
+
+private:
+    std::vector<uint64_t> m_keys;
+};
+
+}
+}
@@ -0,0 +1,275 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "mimax/dma/MinimaxDebugInfo.h"
+
+namespace mimax {
+namespace dma {
+
+template<typename TMove>
+struct SChanceOutcome
+{
+    TMove m_move;
+    float m_probability = 0.0f;
+};
+
+enum class EChancePruning : unsigned char
+{
+    None,
+    // cuts a chance node as soon as its searched outcomes bound its expected value
+    Star1,
+    // Star1 preceded by probing the first move of every outcome to tighten the bounds of the unsearched ones
+    Star2
+};
+
+/*
+Expectiminimax for games with dice or random draws: chance states average the values of their
+outcomes weighted by the probabilities, the players maximize and minimize as in minimax.
+Star1 and Star2 prune chance states using m_minValue and m_maxValue as the bounds of any value,
+so EvaluateState must stay within them.
+
+TMove, TMovesContainer, TResolver and TStatistics follow the CMinimaxBase contract, TResolver additionally provides
+    bool IsChanceState(TState const&)
+    void GetChanceOutcomes(std::vector<SChanceOutcome<TMove>>& outcomesOut, TState const&)
+        the outcomes are applied by MakeMove and their probabilities sum up to 1
+A player move passes the turn to the opponent, a chance outcome keeps the player to move.
+EvaluateState scores from the point of view of the player to move in the root state;
+m_maxDepth counts the player moves only.
+*/
+
+template<typename TState, typename TMove, typename TMovesContainer, typename TResolver, typename TStatistics = SNoMinimaxStatistics>
+class CExpectiminimax
+{
+public:
+    using State = TState;
+    using Move = TMove;
+    using ChanceOutcome = SChanceOutcome<TMove>;
+
+public:
+    struct SConfig
+    {
+        float m_minValue = -1.0f;
+        float m_maxValue = 1.0f;
+        float m_epsilon = std::numeric_limits<float>::epsilon();
+        size_t m_maxDepth = 0;
+        EChancePruning m_chancePruning = EChancePruning::Star2;
+    };
+
+    struct SSearchResult
+    {
+        std::optional<TMove> m_move;
+        float m_score = 0.0f;
+    };
+
+public:
+    CExpectiminimax(TResolver const& resolver, SConfig const& config)
+        : m_resolver(resolver)
+        , m_config(config)
+        , m_isStopRequested(false)
+    {}
+
+    inline std::optional<TMove> FindSolution(TState const& state)
+    {
+        return Search(state).m_move;
+    }
+
+    // the root state is a player state
+    SSearchResult Search(TState const& state)
+    {
+        m_debugInfo.Reset();
+        assert(!m_resolver.IsChanceState(state));
+
+        auto const visitingResult = VisitState(state, true, 0, m_config.m_maxDepth, m_config.m_minValue, m_config.m_maxValue, false);
+
+        SSearchResult result;
+        // the states left by a stopped search keep their initial scores, so it has no move
+        if (!m_isStopRequested)
+        {
+            result.m_score = visitingResult.m_score;
+            if (visitingResult.m_hasMove)
+                result.m_move = visitingResult.m_move;
+        }
+        m_isStopRequested = false;
+        return result;
+    }
+
+    inline void StopAlgorithm() { m_isStopRequested = true; }
+
+    inline TStatistics const& GetDebugInfo() const { return m_debugInfo; }
+
+private:
+    struct STraversalResult
+    {
+        float m_score = 0.0f;
+        bool m_hasMove = false;
+        TMove m_move;
+    };
+
+private:
+    // isProbe searches only the first move, which bounds the value of a max state from below
+    // and of a min state from above
+    STraversalResult VisitState(TState const& state, bool const isMaxState, size_t const ply, size_t const depth, float alpha, float beta, bool const isProbe)
+    {
+        m_debugInfo.VisitNode(ply);
+        if (m_resolver.IsChanceState(state))
+            return VisitChanceState(state, isMaxState, ply, depth, alpha, beta);
+
+        STraversalResult result;
+        TMovesContainer moves;
+        if (depth > 0)
+        {
+            m_resolver.GetPossibleMoves(moves, state);
+        }
+        if (moves.empty())
+        {
+            m_debugInfo.EvaluateNode();
+            result.m_score = m_resolver.EvaluateState(state);
+            return result;
+        }
+
+        result.m_score = isMaxState ? -std::numeric_limits<float>::max() : std::numeric_limits<float>::max();
+        for (size_t i = 0; i < moves.size(); ++i)
+        {
+            if (m_isStopRequested) return result;
+
+            TState childState = state;
+            m_resolver.MakeMove(childState, moves[i]);
+            float const score = VisitState(childState, !isMaxState, ply + 1, depth - 1, alpha, beta, false).m_score;
+            if (isMaxState ? score > result.m_score : score < result.m_score)
+            {
+                result.m_score = score;
+                result.m_move = moves[i];
+                result.m_hasMove = true;
+                if (isMaxState)
+                    alpha = (score > alpha) ? score : alpha;
+                else
+                    beta = (score < beta) ? score : beta;
+                if (alpha + m_config.m_epsilon >= beta)
+                {
+                    m_debugInfo.PruneNodes(moves.size() - (i + 1), ply + 1);
+                    break;
+                }
+            }
+            if (isProbe) break;
+        }
+        return result;
+    }
+
+    // isMaxState is the player to move in the outcomes
+    STraversalResult VisitChanceState(TState const& state, bool const isMaxState, size_t const ply, size_t const depth, float const alpha, float const beta)
+    {
+        std::vector<ChanceOutcome> outcomes;
+        m_resolver.GetChanceOutcomes(outcomes, state);
+
+        // bounds of the outcome values, the unsearched outcomes are assumed to reach them
+        std::vector<float> lowerBounds(outcomes.size(), m_config.m_minValue);
+        std::vector<float> upperBounds(outcomes.size(), m_config.m_maxValue);
+        STraversalResult result;
+        if (m_config.m_chancePruning == EChancePruning::Star2
+            && ProbeOutcomes(state, outcomes, isMaxState, ply, depth, alpha, beta, lowerBounds, upperBounds, result))
+        {
+            return result;
+        }
+
+        bool const isPruning = m_config.m_chancePruning != EChancePruning::None;
+        float remainingLower = 0.0f;
+        float remainingUpper = 0.0f;
+        for (size_t i = 0; i < outcomes.size(); ++i)
+        {
+            remainingLower += outcomes[i].m_probability * lowerBounds[i];
+            remainingUpper += outcomes[i].m_probability * upperBounds[i];
+        }
+
+        float expectedScore = 0.0f;
+        for (size_t i = 0; i < outcomes.size(); ++i)
+        {
+            if (m_isStopRequested) break;
+
+            float const probability = outcomes[i].m_probability;
+            remainingLower -= probability * lowerBounds[i];
+            remainingUpper -= probability * upperBounds[i];
+
+            // the window in which the outcome value still decides whether the chance state is inside (alpha, beta)
+            float const outcomeAlpha = (alpha - expectedScore - remainingUpper) / probability;
+            float const outcomeBeta = (beta - expectedScore - remainingLower) / probability;
+            float const childAlpha = isPruning ? std::max(outcomeAlpha, lowerBounds[i]) : m_config.m_minValue;
+            float const childBeta = isPruning ? std::min(outcomeBeta, upperBounds[i]) : m_config.m_maxValue;
+
+            TState childState = state;
+            m_resolver.MakeMove(childState, outcomes[i].m_move);
+            float const score = VisitState(childState, isMaxState, ply + 1, depth, childAlpha, childBeta, false).m_score;
+            expectedScore += probability * score;
+
+            if (isPruning && (score + m_config.m_epsilon >= outcomeBeta || score <= outcomeAlpha + m_config.m_epsilon))
+            {
+                m_debugInfo.PruneNodes(outcomes.size() - (i + 1), ply + 1);
+                m_debugInfo.CutoffChanceNode();
+                result.m_score = expectedScore + (score + m_config.m_epsilon >= outcomeBeta ? remainingLower : remainingUpper);
+                return result;
+            }
+        }
+
+        result.m_score = expectedScore;
+        return result;
+    }
+
+    // Star2: the first move of every outcome bounds it from one side, returns true if these bounds
+    // already put the chance state outside (alpha, beta)
+    bool ProbeOutcomes(TState const& state, std::vector<ChanceOutcome> const& outcomes, bool const isMaxState, size_t const ply, size_t const depth,
+        float const alpha, float const beta, std::vector<float>& lowerBoundsOut, std::vector<float>& upperBoundsOut, STraversalResult& resultOut)
+    {
+        auto& bounds = isMaxState ? lowerBoundsOut : upperBoundsOut;
+        float boundedScore = 0.0f;
+        for (size_t i = 0; i < outcomes.size(); ++i)
+        {
+            boundedScore += outcomes[i].m_probability * bounds[i];
+        }
+
+        for (size_t i = 0; i < outcomes.size(); ++i)
+        {
+            if (m_isStopRequested) return false;
+
+            TState childState = state;
+            m_resolver.MakeMove(childState, outcomes[i].m_move);
+            if (m_resolver.IsChanceState(childState))
+                continue;
+
+            float const probability = outcomes[i].m_probability;
+            float const othersScore = boundedScore - probability * bounds[i];
+            float const childAlpha = std::max((alpha - othersScore) / probability, m_config.m_minValue);
+            float const childBeta = std::min((beta - othersScore) / probability, m_config.m_maxValue);
+            float const score = VisitState(childState, isMaxState, ply + 1, depth, childAlpha, childBeta, true).m_score;
+
+            // a failed probe bounds the first move from the wrong side
+            bool const isBound = isMaxState ? score > childAlpha : score < childBeta;
+            if (!isBound)
+                continue;
+
+            bounds[i] = score;
+            boundedScore = othersScore + probability * score;
+            bool const isCutoff = isMaxState ? boundedScore + m_config.m_epsilon >= beta : boundedScore <= alpha + m_config.m_epsilon;
+            if (isCutoff)
+            {
+                m_debugInfo.CutoffChanceNode();
+                resultOut.m_score = boundedScore;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    TResolver m_resolver;
+    SConfig m_config;
+    TStatistics m_debugInfo;
+    std::atomic<bool> m_isStopRequested;
+};
+
+} // dma
+} // mimax
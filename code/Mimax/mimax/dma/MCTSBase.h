@@ -1,7 +1,11 @@
 #include <algorithm>
+#include <optional>
 #include <random>
 #include <vector>
 
+#include "mimax/dma/MinimaxResolverTraits.h"
+#include "mimax/dma/OpeningBook.h"
+
 namespace mimax {
 namespace dma {
 
@@ -18,6 +22,11 @@ TResolver
     void GetPossibleMoves(TState const&, TMovesContainer&)
     void MakeMove(TState&, TMove const&)
     float Playout(TState const&)
+
+Optional:
+    uint64_t GetHash(TState const&)
+        enables the opening book (SetOpeningBook), the book moves are indices into GetPossibleMoves
+        as for CMinimaxBase
 */
 
 template<typename TState, typename TMove, typename TMovesContainer, typename TResolver>
@@ -35,13 +44,36 @@ public:
         assert(successful);
     }
 
+    // a root state found in the opening book returns the book move without any iterations;
+    // the book is not owned
+    void SetOpeningBook(COpeningBook const* openingBook)
+    {
+        m_bookMove.reset();
+        if constexpr (HasGetHash<TResolver, TState>)
+        {
+            SOpeningBookEntry entry;
+            if (openingBook == nullptr || !openingBook->Probe(m_resolver.GetHash(m_root.m_state), entry))
+                return;
+
+            m_resolver.GetPossibleMoves(m_root.m_state, m_movesBuffer);
+            if (entry.m_moveIndex < m_movesBuffer.size())
+                m_bookMove = *(m_movesBuffer.begin() + entry.m_moveIndex);
+        }
+    }
+
     void Evaluate()
     {
+        if (m_bookMove.has_value())
+            return;
+
         MakeIteration();
     }
 
     TMove GetCurrentResult() const
     {
+        if (m_bookMove.has_value())
+            return m_bookMove.value();
+
         return std::max_element(m_root.m_children.begin(), m_root.m_children.end(),
             [](SNode const& lhs, SNode const& rhs)
             {
@@ -80,6 +112,7 @@ private:
     SNode m_root;
     float m_explorationParam;
     TMovesContainer m_movesBuffer;
+    std::optional<TMove> m_bookMove;
 
 private:
     bool Expanse(SNode* node)
@@ -1,16 +1,36 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <future>
 #include <limits>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "mimax/dma/MinimaxDebugInfo.h"
+#include "mimax/dma/MinimaxResolverTraits.h"
+#include "mimax/dma/OpeningBook.h"
+#include "mimax/dma/SearchLimits.h"
+#include "mimax/dma/Tablebase.h"
+#include "mimax/dma/TranspositionTable.h"
 
 namespace mimax {
 namespace dma {
 
+/*
+TMove
+    default constructible, copyable, comparable with operator==
+*/
+
 /*
 TMovesContainer
     bool empty()
+    size_t size()
+    TMove& operator[](size_t)
     iter begin()
     iter end()
 */
@@ -20,14 +40,53 @@ TResolver
     float EvaluateState(TState const&)
     void GetPossibleMoves(TMovesContainer&, TState const&)
     void MakeMove(TState&, TMove)
+
+Optional:
+    uint64_t GetHash(TState const&)
+        enables the transposition table (SConfig::m_transpositionTableSize) and the opening book (SetOpeningBook),
+        e.g. Zobrist hash of the state
+    size_t GetMoveIndex(TMove const&)
+        index in [0, SConfig::m_moveIndicesCount), enables the history heuristic
+    void UndoMove(TState&, TMove)
+        reverts MakeMove, the search then mutates a single state instead of copying it for every child
+    void GetNoisyMoves(TMovesContainer&, TState const&)
+        moves which change the evaluation a lot (captures, wins), enables the quiescence search
+    bool MakeNullMove(TState&)
+        passes the turn, returns false and keeps the state if passing is not safe (zugzwang, check);
+        enables the null move pruning
+    using Accumulator
+    void InitializeAccumulator(Accumulator&, TState const&)
+    void UpdateAccumulator(Accumulator& childOut, Accumulator const& parent, TState const& parentState, TMove)
+    float EvaluateAccumulator(Accumulator const&, TState const&)
+        incremental evaluation, the search keeps one accumulator per ply and updates it from the parent
+        before every move, leaves are then evaluated by EvaluateAccumulator instead of EvaluateState
+    void EvaluateStates(std::vector<TState> const&, std::vector<float>& scoresOut)
+        batched EvaluateState (see CNeuralNetworkEvaluator), enables m_useBatchedEvaluation
+    bool GetTablebaseIndex(TState const&, size_t& indexOut)
+        index of the state in the tablebase set by SetTablebase (see CTablebaseBuilder),
+        returns false for states the tablebase doesn't cover
+    size_t CanonicalizeState(TState const&, TState& canonicalStateOut)
+    TMove TransformMove(TMove const&, size_t symmetry)
+    TMove RestoreMove(TMove const&, size_t symmetry)
+        symmetries of the board, the canonical state is the representative of all the states equal up to
+        a symmetry (e.g. the smallest of the 8 rotations and reflections of a square board) and the returned
+        symmetry maps the state onto it; TransformMove maps a move of the state to the canonical state and
+        RestoreMove back. The transposition table then keeps one entry for all symmetric states, TState
+        must be default constructible
+*/
+
+/*
+TStatistics
+    SNoMinimaxStatistics collects nothing, SMinimaxDebugInfo counts nodes, cutoffs and depth times
 */
 
-template<typename TState, typename TMove, typename TMovesContainer, typename TResolver>
+template<typename TState, typename TMove, typename TMovesContainer, typename TResolver, typename TStatistics = SNoMinimaxStatistics>
 class CMinimaxBase
 {
 public:
     using State = TState;
     using Move = TMove;
+    using TranspositionTable = CTranspositionTable<TMove>;
 
 public:
     struct SConfig
@@ -36,98 +95,1091 @@ public:
         float m_maxValue = 1.0f;
         float m_epsilon = std::numeric_limits<float>::epsilon();
         size_t m_maxDepth = 0;
+        // searches depths 1..m_maxDepth, a stopped search keeps the result of the last completed depth
+        bool m_useIterativeDeepening = false;
+        // first iterative deepening depth
+        size_t m_minDepth = 1;
+        // rotates the root moves before the search, varies the moves order of parallel searchers
+        size_t m_rootMovesRotation = 0;
+        // entries count, rounded down to a power of two; 0 disables the table
+        size_t m_transpositionTableSize = 0;
+        // searches the last two moves which caused a cutoff at the same ply first
+        bool m_useKillerMoves = false;
+        // orders moves by the cutoffs they caused anywhere in the tree; 0 disables the history heuristic
+        size_t m_moveIndicesCount = 0;
+        // searches all but the first child with a null window and re-searches the ones which fail high
+        bool m_usePrincipalVariationSearch = false;
+        // half-width of the root window around the previous iteration score; 0 disables aspiration windows
+        float m_aspirationWindow = 0.0f;
+        // plies of noisy moves searched beyond m_maxDepth before a state is evaluated; 0 disables quiescence search
+        size_t m_maxQuiescenceDepth = 0;
+        // depth reduction R of the null move search; 0 disables null move pruning
+        size_t m_nullMoveReduction = 0;
+        // moves from this index on are searched with a reduced depth first; 0 disables late move reductions
+        size_t m_lateMoveMinIndex = 0;
+        size_t m_lateMoveMinDepth = 3;
+        size_t m_lateMoveReduction = 1;
+        // children of the last searched depth are evaluated together by one EvaluateStates call
+        bool m_useBatchedEvaluation = false;
+        // the transposition table, history and killer moves are kept between searches of one game,
+        // every search has to start with the same player to move; see ClearSearchData
+        bool m_keepSearchData = false;
+        // best root moves returned with exact scores in SSearchResult::m_rootMoves, the root window
+        // is lowered only to the score of the last of them
+        size_t m_multiPVCount = 1;
+        // fills the principal variations of m_rootMoves from the transposition table
+        bool m_collectPrincipalVariations = false;
+        // finds the root score by zero window searches converging from the previous depth score instead of
+        // one full window search; relies on the transposition table to re-search cheaply
+        bool m_useMTDf = false;
+    };
+
+    struct SRootMove
+    {
+        TMove m_move;
+        float m_score = 0.0f;
+        // starts with m_move
+        std::vector<TMove> m_principalVariation;
+    };
+
+    struct SSearchResult
+    {
+        std::optional<TMove> m_move;
+        float m_score = 0.0f;
+        size_t m_completedDepth = 0;
+        // root score of every completed depth
+        std::vector<float> m_iterationScores;
+        // expected reply to m_move from the transposition table, see StartPondering
+        std::optional<TMove> m_ponderMove;
+        size_t m_visitedNodesCnt = 0;
+        // at most m_multiPVCount root moves of the last completed depth, the best first
+        std::vector<SRootMove> m_rootMoves;
     };
 
 public:
     CMinimaxBase(TResolver const& resolver, SConfig const& config)
+        : CMinimaxBase(resolver, config, nullptr)
+    {}
+
+    // sharedTable is used instead of an own transposition table, its owner is responsible for clearing it
+    CMinimaxBase(TResolver const& resolver, SConfig const& config, TranspositionTable* sharedTable)
         : m_resolver(resolver)
         , m_config(config)
+        , m_sharedTranspositionTable(sharedTable)
         , m_isStopRequested(false)
-    {}
+        , m_stopRequestsCnt(0)
+    {
+        if constexpr (HasGetHash<TResolver, TState>)
+        {
+            if (m_sharedTranspositionTable == nullptr)
+                m_ownTranspositionTable.Resize(m_config.m_transpositionTableSize);
+        }
+        if constexpr (HasGetMoveIndex<TResolver, TMove>)
+        {
+            m_historyTable.resize(2 * m_config.m_moveIndicesCount);
+        }
+        if (m_config.m_useKillerMoves)
+        {
+            m_killerMoves.resize(m_config.m_maxDepth + 1);
+        }
+        if (IsMoveOrderingEnabled())
+        {
+            m_orderingScores.resize(m_config.m_maxDepth + 1);
+        }
+        if constexpr (HasAccumulator<TResolver>)
+        {
+            m_accumulators.resize(m_config.m_maxDepth + m_config.m_maxQuiescenceDepth + 1);
+        }
+    }
+
+    ~CMinimaxBase()
+    {
+        StopPondering();
+    }
 
     inline std::optional<TMove> FindSolution(TState const& state)
     {
-#if MIMAX_MINIMAX_DEBUG
-        m_debugInfo.Reset();
-#endif // MIMAX_MINIMAX_DEBUG
-        auto const visitingResult = VisitState(state, 0, m_config.m_minValue, m_config.m_maxValue);
-        auto const move = m_isStopRequested
-            ? std::optional<TMove>()
-            : visitingResult.m_move;
+        return Search(state).m_move;
+    }
+
+    inline SSearchResult Search(TState const& state)
+    {
+        return Search(state, SSearchLimits());
+    }
+
+    // the search stops itself when a budget of limits is spent and returns the last completed depth,
+    // so a hard limit should leave time for the first depth; StopAlgorithm called while no search runs
+    // stops the next one, see ResetStopRequest
+    SSearchResult Search(TState const& state, SSearchLimits const& limits)
+    {
+        StopPondering();
+        SSearchResult result;
+        if (!IsOpeningBookHit(state, result))
+        {
+            result = RunSearch(state, limits);
+        }
+        m_isStopRequested = false;
+        return result;
+    }
+
+    // searches the state after the expected reply in the background while the opponent thinks,
+    // the work is reused by the next Search through the kept search data, so m_keepSearchData is required
+    void StartPondering(TState const& state, TMove const& expectedReply)
+    {
+        assert(m_config.m_keepSearchData && "pondering without m_keepSearchData is discarded by the next Search");
+        StopPondering();
+        TState ponderState = state;
+        m_resolver.MakeMove(ponderState, expectedReply);
+        m_ponderingFuture = std::async(std::launch::async, [this, ponderState]()
+            {
+                RunSearch(ponderState, SSearchLimits());
+            });
+    }
+
+    void StopPondering()
+    {
+        if (!m_ponderingFuture.valid())
+            return;
+
+        // the stop requests of the owner which arrive meanwhile are kept for the next search
+        size_t const stopRequestsCnt = m_stopRequestsCnt;
+        m_isStopRequested = true;
+        m_ponderingFuture.wait();
+        m_ponderingFuture = std::future<void>();
         m_isStopRequested = false;
-        return move;
+        if (m_stopRequestsCnt != stopRequestsCnt)
+            m_isStopRequested = true;
+    }
+
+    // states found in the tablebase are not searched, their score is the middle for draws and maxValue or minValue
+    // moved towards the middle by m_epsilon per ply from the root to the end of the game for wins and losses,
+    // so m_epsilon times the longest game has to stay below half of the values range; the tablebase is not owned,
+    // the scores which come from it depend on the ply and are not stored in the transposition table
+    inline void SetTablebase(CTablebase const* tablebase) { m_tablebase = tablebase; }
+
+    // root states found in the opening book return the book move without searching, requires GetHash;
+    // the book is not owned
+    inline void SetOpeningBook(COpeningBook const* openingBook) { m_openingBook = openingBook; }
+
+    inline bool IsPondering() const { return m_ponderingFuture.valid(); }
+    // the background search has completed, it is still reported by IsPondering until StopPondering or Search
+    inline bool IsPonderingFinished() const
+    {
+        return m_ponderingFuture.valid() && m_ponderingFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    // the root moves searched one by one, e.g. split between several searchers (see CMinimaxRootSplitting):
+    // StartRootMovesSearch prepares the search of the state as Search does and the following SearchRootMove
+    // calls on the same state share the search data
+    void StartRootMovesSearch(TState const& state, SSearchLimits const& limits)
+    {
+        StopPondering();
+        PrepareSearch(state, limits);
+    }
+
+    // score of the move for the player to move in the state, exact only inside the root window (alpha, beta);
+    // moveIndex > 0 searches a null window first with m_usePrincipalVariationSearch
+    float SearchRootMove(TState const& state, TMove const& move, size_t const depth, float const alpha, float const beta, size_t const moveIndex)
+    {
+        assert(depth > 0);
+        TState rootState = state;
+        auto const childResult = VisitMove(rootState, move, 1, depth - 1, alpha, beta, moveIndex);
+        return -childResult.m_score;
+    }
+
+    // written by the pondering thread, read it only when IsPondering is false
+    inline size_t GetVisitedNodesCount() const { return m_limiter.GetVisitedNodesCount(); }
+
+    // forgets the transposition table and move ordering data of the previous searches, e.g. before a new game;
+    // must not be called while pondering
+    void ClearSearchData()
+    {
+        m_ownTranspositionTable.Clear();
+        std::fill(m_historyTable.begin(), m_historyTable.end(), 0);
+        std::fill(m_killerMoves.begin(), m_killerMoves.end(), SKillerMoves());
     }
 
-    inline void StopAlgorithm() { m_isStopRequested = true; }
+    inline void StopAlgorithm()
+    {
+        ++m_stopRequestsCnt;
+        m_isStopRequested = true;
+    }
+    inline bool IsStopRequested() const { return m_isStopRequested; }
+    // drops a stop request which arrived after the last search had already finished; called by the owner
+    // before it starts the next search on another thread, a stop arriving after that is kept
+    inline void ResetStopRequest() { m_isStopRequested = false; }
 
-#if MIMAX_MINIMAX_DEBUG
-    inline SMinimaxDebugInfo const& GetDebugInfo() const { return m_debugInfo; }
-#endif // MIMAX_MINIMAX_DEBUG
+    // written by the pondering thread, read it only when IsPondering is false
+    inline TStatistics const& GetDebugInfo() const { return m_debugInfo; }
 
 private:
     struct STraversalResult
     {
         float m_score = 0.0f;
         TMove m_move; 
+        // the score comes from a tablebase hit, it counts the plies from the root and is not stored
+        bool m_isTablebaseScore = false;
+    };
+
+    struct SKillerMoves
+    {
+        static constexpr size_t SLOTS_COUNT = 2;
+
+        TMove m_moves[SLOTS_COUNT];
+        size_t m_count = 0;
     };
 
 private:
-    STraversalResult VisitState(TState const& state, size_t const depth, float alpha, float beta)
+    // m_completedDepth of the book result is the depth of the search which built the book
+    bool IsOpeningBookHit(TState const& state, SSearchResult& resultOut)
     {
-#if MIMAX_MINIMAX_DEBUG
-        m_debugInfo.VisitNode(depth);
-#endif // MIMAX_MINIMAX_DEBUG
+        if constexpr (HasGetHash<TResolver, TState>)
+        {
+            SOpeningBookEntry entry;
+            if (m_openingBook == nullptr || !m_openingBook->Probe(m_resolver.GetHash(state), entry))
+                return false;
+
+            TMovesContainer moves;
+            m_resolver.GetPossibleMoves(moves, state);
+            if (entry.m_moveIndex >= moves.size())
+                return false;
+
+            m_debugInfo.Reset();
+            TMove const move = moves[entry.m_moveIndex];
+            resultOut.m_move = move;
+            resultOut.m_score = entry.m_score;
+            resultOut.m_completedDepth = entry.m_depth;
+            resultOut.m_rootMoves.push_back({ move, entry.m_score, { move } });
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    void PrepareSearch(TState const& rootState, SSearchLimits const& limits)
+    {
+        m_debugInfo.Reset();
+        m_limiter.Start(limits);
+        if (m_config.m_keepSearchData)
+        {
+            AgeSearchData();
+        }
+        else
+        {
+            ClearSearchData();
+        }
+
+        if constexpr (HasAccumulator<TResolver>)
+        {
+            m_resolver.InitializeAccumulator(m_accumulators[0], rootState);
+        }
+        m_hasRootMoveHint = false;
+    }
+
+    SSearchResult RunSearch(TState const& state, SSearchLimits const& limits)
+    {
+        PrepareSearch(state, limits);
+
+        SSearchResult result;
+        TState rootState = state;
+        size_t const maxDepth = (limits.m_maxDepth > 0 && limits.m_maxDepth < m_config.m_maxDepth)
+            ? limits.m_maxDepth
+            : m_config.m_maxDepth;
+        size_t const firstDepth = m_config.m_useIterativeDeepening
+            ? std::min(std::max<size_t>(m_config.m_minDepth, 1), maxDepth)
+            : maxDepth;
+        std::vector<SRootMove> rootMoves;
+        for (size_t depth = firstDepth; depth <= maxDepth; ++depth)
+        {
+            rootMoves.clear();
+            m_debugInfo.StartDepth(depth);
+            auto const visitingResult = (m_config.m_multiPVCount > 1)
+                ? VisitMultiPVRoot(rootState, depth, result, rootMoves)
+                : VisitRoot(rootState, depth, result);
+            if (m_isStopRequested) break;
+
+            m_debugInfo.FinishDepth(depth);
+            result.m_move = visitingResult.m_move;
+            result.m_score = visitingResult.m_score;
+            result.m_completedDepth = depth;
+            result.m_iterationScores.push_back(visitingResult.m_score);
+            result.m_rootMoves.swap(rootMoves);
+            m_rootMoveHint = visitingResult.m_move;
+            m_hasRootMoveHint = true;
+            if (m_limiter.IsSoftTimeExceeded()) break;
+        }
+        result.m_visitedNodesCnt = m_limiter.GetVisitedNodesCount();
+        if (result.m_move.has_value())
+        {
+            result.m_ponderMove = GetExpectedReply(rootState, result.m_move.value());
+            if (result.m_rootMoves.empty())
+                result.m_rootMoves.push_back({ result.m_move.value(), result.m_score, {} });
+            if (m_config.m_collectPrincipalVariations)
+            {
+                for (auto& rootMove : result.m_rootMoves)
+                {
+                    CollectPrincipalVariation(rootState, rootMove, result.m_completedDepth);
+                }
+            }
+        }
+        return result;
+    }
+
+    void AgeSearchData()
+    {
+        m_ownTranspositionTable.NextGeneration();
+        for (auto& value : m_historyTable)
+        {
+            value /= 2;
+        }
+    }
+
+    std::optional<TMove> GetExpectedReply(TState const& rootState, TMove const& move)
+    {
+        if constexpr (HasGetHash<TResolver, TState>)
+        {
+            auto const& transpositionTable = GetTranspositionTable();
+            typename TranspositionTable::SEntry entry;
+            TState childState = rootState;
+            m_resolver.MakeMove(childState, move);
+            if (transpositionTable.IsEnabled() && ProbeTransposition(childState, entry) && entry.m_hasMove)
+                return entry.m_move;
+        }
+        return std::nullopt;
+    }
+
+    STraversalResult VisitRoot(TState& state, size_t const depth, SSearchResult const& previousResult)
+    {
+        if (m_config.m_useMTDf)
+        {
+            float const guess = previousResult.m_completedDepth > 0
+                ? previousResult.m_score
+                : 0.5f * (m_config.m_minValue + m_config.m_maxValue);
+            return VisitMTDfRoot(state, depth, guess);
+        }
+        if (m_config.m_aspirationWindow > 0.0f && previousResult.m_completedDepth > 0)
+        {
+            float const alpha = std::max(previousResult.m_score - m_config.m_aspirationWindow, m_config.m_minValue);
+            float const beta = std::min(previousResult.m_score + m_config.m_aspirationWindow, m_config.m_maxValue);
+            auto const result = VisitState(state, 0, depth, alpha, beta);
+            bool const isInsideWindow = result.m_score > alpha && result.m_score + m_config.m_epsilon < beta;
+            if (m_isStopRequested || isInsideWindow)
+                return result;
+            m_debugInfo.ResearchAspirationWindow();
+        }
+        return VisitState(state, 0, depth, m_config.m_minValue, m_config.m_maxValue);
+    }
+
+    // every zero window search tells whether the score is above or below its window and tightens the bounds,
+    // the move comes from the last search which failed high as the moves of fail-low searches are not reliable
+    STraversalResult VisitMTDfRoot(TState& state, size_t const depth, float const guess)
+    {
+        float const windowWidth = 2.0f * m_config.m_epsilon;
+        float lowerBound = -std::numeric_limits<float>::max();
+        float upperBound = std::numeric_limits<float>::max();
+        STraversalResult result;
+        result.m_score = guess;
+        bool hasFailedHigh = false;
+        TMove failHighMove;
+        while (lowerBound + m_config.m_epsilon < upperBound)
+        {
+            float const beta = (result.m_score == lowerBound) ? result.m_score + windowWidth : result.m_score;
+            m_debugInfo.SearchZeroWindow();
+            result = VisitState(state, 0, depth, beta - windowWidth, beta);
+            if (m_isStopRequested) return result;
+
+            if (result.m_score + m_config.m_epsilon >= beta)
+            {
+                lowerBound = result.m_score;
+                failHighMove = result.m_move;
+                hasFailedHigh = true;
+            }
+            else
+            {
+                upperBound = result.m_score;
+            }
+        }
+        if (hasFailedHigh)
+        {
+            result.m_move = failHighMove;
+        }
+        return result;
+    }
+
+    // a root move is searched with the window lowered to the score of the last kept move, so the moves
+    // which can't enter the m_multiPVCount best ones fail low and only the kept ones get exact scores
+    STraversalResult VisitMultiPVRoot(TState& state, size_t const depth, SSearchResult const& previousResult, std::vector<SRootMove>& rootMovesOut)
+    {
+        m_debugInfo.VisitNode(0);
+        VisitLimitedNode();
+        STraversalResult result;
         TMovesContainer moves;
-        if(depth != m_config.m_maxDepth)
+        if (depth > 0)
         {
             m_resolver.GetPossibleMoves(moves, state);
         }
+        if (moves.empty())
+        {
+            m_debugInfo.EvaluateNode();
+            result.m_score = EvaluateState(state, 0);
+            return result;
+        }
+        m_debugInfo.ExpandNode(moves.size());
+
+        if (IsMoveOrderingEnabled())
+        {
+            SortMoves(moves, 0);
+        }
+        if (m_config.m_rootMovesRotation > 0)
+        {
+            std::rotate(moves.begin(), moves.begin() + (m_config.m_rootMovesRotation % moves.size()), moves.end());
+        }
+        // the best moves of the previous depth are likely the best ones again
+        for (auto it = previousResult.m_rootMoves.rbegin(); it != previousResult.m_rootMoves.rend(); ++it)
+        {
+            MoveToFront(moves, it->m_move);
+        }
+
+        for (size_t i = 0; i < moves.size(); ++i)
+        {
+            if (m_isStopRequested) return result;
+
+            bool const isFull = rootMovesOut.size() >= m_config.m_multiPVCount;
+            float const alpha = isFull ? rootMovesOut.back().m_score : m_config.m_minValue;
+            // every move is a principal variation until the list is full
+            auto const childResult = VisitMove(state, moves[i], 1, depth - 1, alpha, m_config.m_maxValue, isFull ? i : 0);
+            float const score = -childResult.m_score;
+            if (m_isStopRequested) return result;
+            if (isFull && score <= alpha + m_config.m_epsilon)
+                continue;
+
+            auto it = rootMovesOut.begin();
+            for (; it != rootMovesOut.end() && it->m_score >= score; ++it) {}
+            rootMovesOut.insert(it, { moves[i], score, {} });
+            if (rootMovesOut.size() > m_config.m_multiPVCount)
+                rootMovesOut.pop_back();
+        }
+
+        result.m_move = rootMovesOut.front().m_move;
+        result.m_score = rootMovesOut.front().m_score;
+        if constexpr (HasGetHash<TResolver, TState>)
+        {
+            if (GetTranspositionTable().IsEnabled())
+            {
+                size_t symmetry = 0;
+                uint64_t const hash = GetStateHash(state, symmetry);
+                StoreTransposition(hash, symmetry, result, depth, m_config.m_minValue, m_config.m_maxValue);
+            }
+        }
+        return result;
+    }
+
+    // follows the transposition table moves after the root move, at most depth moves long
+    void CollectPrincipalVariation(TState const& rootState, SRootMove& rootMove, size_t const depth)
+    {
+        rootMove.m_principalVariation.assign(1, rootMove.m_move);
+        if constexpr (HasGetHash<TResolver, TState>)
+        {
+            auto const& transpositionTable = GetTranspositionTable();
+            if (!transpositionTable.IsEnabled())
+                return;
+
+            TState state = rootState;
+            m_resolver.MakeMove(state, rootMove.m_move);
+            typename TranspositionTable::SEntry entry;
+            while (rootMove.m_principalVariation.size() < depth
+                && ProbeTransposition(state, entry) && entry.m_hasMove)
+            {
+                rootMove.m_principalVariation.push_back(entry.m_move);
+                m_resolver.MakeMove(state, entry.m_move);
+            }
+        }
+    }
+
+    // ply is the distance from the root, depth is the remaining search depth
+    STraversalResult VisitState(TState& state, size_t const ply, size_t const depth, float alpha, float beta)
+    {
+        m_debugInfo.VisitNode(ply);
+        VisitLimitedNode();
         STraversalResult result;
+
+        uint64_t hash = 0;
+        size_t symmetry = 0;
+        bool hasHashMove = false;
+        TMove hashMove{};
+        if constexpr (HasGetHash<TResolver, TState>)
+        {
+            auto& transpositionTable = GetTranspositionTable();
+            typename TranspositionTable::SEntry entry;
+            if (transpositionTable.IsEnabled())
+            {
+                hash = GetStateHash(state, symmetry);
+                if (ProbeTransposition(hash, symmetry, entry))
+                {
+                    m_debugInfo.HitTransposition();
+                    hasHashMove = entry.m_hasMove;
+                    hashMove = entry.m_move;
+                    if (ply > 0 && entry.m_depth >= depth && IsTranspositionCutoff(entry, alpha, beta))
+                    {
+                        result.m_score = entry.m_score;
+                        result.m_move = entry.m_move;
+                        return result;
+                    }
+                }
+            }
+        }
+
+        if constexpr (HasGetTablebaseIndex<TResolver, TState>)
+        {
+            if (ply > 0 && IsTablebaseHit(state, ply, result))
+                return result;
+        }
+
+        if constexpr (HasGetNoisyMoves<TResolver, TState, TMovesContainer>)
+        {
+            if (depth == 0 && m_config.m_maxQuiescenceDepth > 0)
+                return VisitQuiescenceState(state, ply, m_config.m_maxQuiescenceDepth, alpha, beta);
+        }
+
+        TMovesContainer moves;
+        if(depth > 0)
+        {
+            m_resolver.GetPossibleMoves(moves, state);
+        }
         if(moves.empty())
         {
-#if MIMAX_MINIMAX_DEBUG
             m_debugInfo.EvaluateNode();
-#endif // MIMAX_MINIMAX_DEBUG
-            int const colorMultiplier = (depth & 1) == 0 ? 1 : -1;
-            result.m_score = m_resolver.EvaluateState(state) * colorMultiplier;
+            int const colorMultiplier = (ply & 1) == 0 ? 1 : -1;
+            result.m_score = EvaluateState(state, ply) * colorMultiplier;
             return result; 
         }
 
+        m_debugInfo.ExpandNode(moves.size());
+
+        if constexpr (HasMakeNullMove<TResolver, TState>)
+        {
+            if (ply > 0 && IsNullMoveCutoff(state, ply, depth, beta, result))
+                return result;
+        }
+
+        if (IsMoveOrderingEnabled())
+        {
+            SortMoves(moves, ply);
+        }
+        if (ply == 0 && m_config.m_rootMovesRotation > 0)
+        {
+            std::rotate(moves.begin(), moves.begin() + (m_config.m_rootMovesRotation % moves.size()), moves.end());
+        }
+        if (hasHashMove)
+        {
+            MoveToFront(moves, hashMove);
+        }
+        else if (ply == 0 && m_hasRootMoveHint)
+        {
+            MoveToFront(moves, m_rootMoveHint);
+        }
+
+        float const initialAlpha = alpha;
         result.m_score = -std::numeric_limits<float>::max();
 
+        bool isBatchEvaluated = false;
+        if constexpr (HasEvaluateStates<TResolver, TState>)
+        {
+            if (depth == 1 && IsBatchedEvaluationEnabled())
+            {
+                VisitFrontierMoves(state, moves, ply, alpha, beta, result);
+                isBatchEvaluated = true;
+            }
+        }
+
+        for (size_t i = 0; i < moves.size() && !isBatchEvaluated; ++i)
+        {
+            if (m_isStopRequested) return result;
+
+            auto const move = moves[i];
+            auto const childResult = VisitMove(state, move, ply + 1, depth - 1, alpha, beta, i);
+            if (-childResult.m_score > result.m_score)
+            {
+                result.m_move = move;
+                result.m_score = -childResult.m_score;
+                result.m_isTablebaseScore = childResult.m_isTablebaseScore;
+                alpha = (result.m_score > alpha) ? result.m_score : alpha;
+                if (alpha + m_config.m_epsilon >= beta)
+                {
+                    m_debugInfo.PruneNodes(moves.size() - (i + 1), ply + 1);
+                    m_debugInfo.CutoffMove(i);
+                    RegisterCutoffMove(move, ply, depth);
+                    break;
+                }
+            }
+        }
+
+        if constexpr (HasGetHash<TResolver, TState>)
+        {
+            if (GetTranspositionTable().IsEnabled() && !m_isStopRequested && !result.m_isTablebaseScore)
+            {
+                StoreTransposition(hash, symmetry, result, depth, initialAlpha, beta);
+            }
+        }
+
+        return result;
+    }
+
+    // the stand pat score bounds the state value from below, only noisy moves can improve it
+    STraversalResult VisitQuiescenceState(TState& state, size_t const ply, size_t const depth, float alpha, float const beta)
+    {
+        m_debugInfo.VisitNode(ply);
+        m_debugInfo.VisitQuiescenceNode();
+        m_debugInfo.EvaluateNode();
+        VisitLimitedNode();
+        int const colorMultiplier = (ply & 1) == 0 ? 1 : -1;
+        STraversalResult result;
+        result.m_score = EvaluateState(state, ply) * colorMultiplier;
+        if (depth == 0 || result.m_score + m_config.m_epsilon >= beta)
+            return result;
+        alpha = (result.m_score > alpha) ? result.m_score : alpha;
+
+        TMovesContainer moves;
+        m_resolver.GetNoisyMoves(moves, state);
         for (size_t i = 0; i < moves.size(); ++i)
         {
             if (m_isStopRequested) return result;
 
             auto const move = moves[i];
-            TState childState = state;
-            m_resolver.MakeMove(childState, move);
-            auto const childResult = VisitState(childState, depth + 1, -beta, -alpha);
+            auto const childResult = ApplyMove(state, move, ply + 1, [&](TState& childState)
+                {
+                    return VisitQuiescenceState(childState, ply + 1, depth - 1, -beta, -alpha);
+                });
             if (-childResult.m_score > result.m_score)
             {
                 result.m_move = move;
                 result.m_score = -childResult.m_score;
                 alpha = (result.m_score > alpha) ? result.m_score : alpha;
+                if (alpha + m_config.m_epsilon >= beta)
+                    break;
+            }
+        }
+        return result;
+    }
+
+    inline STraversalResult VisitMove(TState& state, TMove const& move, size_t const ply, size_t const depth, float const alpha, float const beta, size_t const moveIndex)
+    {
+        return ApplyMove(state, move, ply, [&](TState& childState)
+            {
+                return VisitChildState(childState, ply, depth, alpha, beta, moveIndex);
+            });
+    }
+
+    inline void VisitLimitedNode()
+    {
+        if (m_limiter.VisitNode())
+            m_isStopRequested = true;
+    }
+
+    // a decided state loses m_epsilon per ply from the root to the end of the game, so shorter wins and longer losses
+    // score better and the parent of a win in d plies scores as a loss in d + 1
+    bool IsTablebaseHit(TState const& state, size_t const ply, STraversalResult& resultOut)
+    {
+        size_t index = 0;
+        STablebaseEntry entry;
+        if (m_tablebase == nullptr || !m_resolver.GetTablebaseIndex(state, index) || !m_tablebase->Probe(index, entry))
+            return false;
+
+        m_debugInfo.HitTablebase();
+        float const distanceScore = static_cast<float>(ply + entry.m_distance) * m_config.m_epsilon;
+        resultOut.m_score = entry.m_result == ETablebaseResult::Win ? m_config.m_maxValue - distanceScore
+            : (entry.m_result == ETablebaseResult::Loss ? m_config.m_minValue + distanceScore : 0.5f * (m_config.m_minValue + m_config.m_maxValue));
+        resultOut.m_isTablebaseScore = true;
+        return true;
+    }
+
+    // a state whose null window search after passing the turn still fails high is pruned,
+    // the null move is never searched inside another null move search
+    bool IsNullMoveCutoff(TState const& state, size_t const ply, size_t const depth, float const beta, STraversalResult& resultOut)
+    {
+        if (m_config.m_nullMoveReduction == 0 || depth <= m_config.m_nullMoveReduction || m_isInNullMoveSearch)
+            return false;
+
+        TState nullState = state;
+        if (!m_resolver.MakeNullMove(nullState))
+            return false;
+
+        if constexpr (HasAccumulator<TResolver>)
+        {
+            m_accumulators[ply + 1] = m_accumulators[ply];
+        }
+        m_isInNullMoveSearch = true;
+        float const nullWindowAlpha = beta - 2.0f * m_config.m_epsilon;
+        auto const nullResult = VisitState(nullState, ply + 1, depth - 1 - m_config.m_nullMoveReduction, -beta, -nullWindowAlpha);
+        m_isInNullMoveSearch = false;
+
+        float const score = -nullResult.m_score;
+        if (m_isStopRequested || score + m_config.m_epsilon < beta)
+            return false;
+
+        m_debugInfo.CutoffNullMove();
+        resultOut.m_score = score;
+        resultOut.m_isTablebaseScore = nullResult.m_isTablebaseScore;
+        return true;
+    }
+
+    inline size_t GetLateMoveReduction(size_t const childDepth, size_t const moveIndex) const
+    {
+        if (m_config.m_lateMoveMinIndex == 0 || moveIndex < m_config.m_lateMoveMinIndex || childDepth + 1 < m_config.m_lateMoveMinDepth)
+            return 0;
+        return m_config.m_lateMoveReduction < childDepth ? m_config.m_lateMoveReduction : childDepth;
+    }
+
+    inline bool IsBatchedEvaluationEnabled() const
+    {
+        // noisy children are not leaves, they continue with the quiescence search
+        return m_config.m_useBatchedEvaluation && m_config.m_maxQuiescenceDepth == 0 && !m_isStopRequested;
+    }
+
+    // all children of a frontier state are leaves, those not resolved by the transposition table or
+    // the tablebase are evaluated by one EvaluateStates call; the scores are then consumed in the moves
+    // order, so the cutoffs still update the killers and history
+    void VisitFrontierMoves(TState const& state, TMovesContainer const& moves, size_t const ply, float alpha, float const beta, STraversalResult& result)
+    {
+        m_frontierStates.clear();
+        m_frontierMoveIndices.clear();
+        m_frontierMoveResults.resize(moves.size());
+        for (size_t i = 0; i < moves.size(); ++i)
+        {
+            if (m_isStopRequested) return;
+
+            m_debugInfo.VisitNode(ply + 1);
+            VisitLimitedNode();
+            m_frontierStates.push_back(state);
+            m_resolver.MakeMove(m_frontierStates.back(), moves[i]);
+            // the window only narrows while the scores are consumed, a cutoff for the current one stays valid
+            STraversalResult childResult;
+            if (IsFrontierChildResolved(m_frontierStates.back(), ply + 1, -beta, -alpha, childResult))
+            {
+                m_frontierStates.pop_back();
+                m_frontierMoveResults[i].m_score = -childResult.m_score;
+                m_frontierMoveResults[i].m_isTablebaseScore = childResult.m_isTablebaseScore;
+            }
+            else
+            {
+                m_frontierMoveIndices.push_back(i);
+            }
+        }
+
+        if (!m_frontierStates.empty())
+        {
+            m_frontierScores.resize(m_frontierStates.size());
+            m_resolver.EvaluateStates(m_frontierStates, m_frontierScores);
+            m_debugInfo.EvaluateBatch();
+            int const colorMultiplier = (ply & 1) == 0 ? 1 : -1;
+            for (size_t i = 0; i < m_frontierStates.size(); ++i)
+            {
+                m_debugInfo.EvaluateNode();
+                auto& moveResult = m_frontierMoveResults[m_frontierMoveIndices[i]];
+                moveResult.m_score = m_frontierScores[i] * colorMultiplier;
+                moveResult.m_isTablebaseScore = false;
+            }
+        }
+
+        for (size_t i = 0; i < moves.size(); ++i)
+        {
+            float const score = m_frontierMoveResults[i].m_score;
+            if (score > result.m_score)
+            {
+                result.m_move = moves[i];
+                result.m_score = score;
+                result.m_isTablebaseScore = m_frontierMoveResults[i].m_isTablebaseScore;
+                alpha = (result.m_score > alpha) ? result.m_score : alpha;
                 if (alpha + m_config.m_epsilon >= beta)
                 {
-#if MIMAX_MINIMAX_DEBUG
-                    m_debugInfo.PruneNodes(moves.size() - (i + 1), depth + 1);
-#endif // MIMAX_MINIMAX_DEBUG
+                    // the remaining children are already visited, nothing is pruned
+                    m_debugInfo.CutoffMove(i);
+                    RegisterCutoffMove(moves[i], ply, 1);
                     break;
                 }
             }
         }
+    }
+
+    // the same probes VisitState does for a leaf; leaves are never stored, the frontier state is
+    bool IsFrontierChildResolved(TState const& childState, size_t const childPly, float const alpha, float const beta, STraversalResult& resultOut)
+    {
+        if constexpr (HasGetHash<TResolver, TState>)
+        {
+            if (GetTranspositionTable().IsEnabled())
+            {
+                size_t symmetry = 0;
+                uint64_t const hash = GetStateHash(childState, symmetry);
+                typename TranspositionTable::SEntry entry;
+                if (ProbeTransposition(hash, symmetry, entry))
+                {
+                    m_debugInfo.HitTransposition();
+                    // any entry is at least as deep as a leaf
+                    if (IsTranspositionCutoff(entry, alpha, beta))
+                    {
+                        resultOut.m_score = entry.m_score;
+                        return true;
+                    }
+                }
+            }
+        }
+
+        if constexpr (HasGetTablebaseIndex<TResolver, TState>)
+        {
+            if (IsTablebaseHit(childState, childPly, resultOut))
+                return true;
+        }
+        return false;
+    }
+
+    inline float EvaluateState(TState const& state, size_t const ply)
+    {
+        if constexpr (HasAccumulator<TResolver>)
+            return m_resolver.EvaluateAccumulator(m_accumulators[ply], state);
+        else
+            return m_resolver.EvaluateState(state);
+    }
+
+    // calls visit with the state after the move, by make/unmake or on a copy depending on the resolver
+    template<typename TVisit>
+    inline STraversalResult ApplyMove(TState& state, TMove const& move, size_t const childPly, TVisit const& visit)
+    {
+        if constexpr (HasAccumulator<TResolver>)
+        {
+            m_resolver.UpdateAccumulator(m_accumulators[childPly], m_accumulators[childPly - 1], state, move);
+        }
+        if constexpr (HasUndoMove<TResolver, TState, TMove>)
+        {
+            m_resolver.MakeMove(state, move);
+            auto const result = visit(state);
+            m_resolver.UndoMove(state, move);
+            return result;
+        }
+        else
+        {
+            TState childState = state;
+            m_resolver.MakeMove(childState, move);
+            return visit(childState);
+        }
+    }
 
+    // alpha and beta are the parent window, returns the child score from the child point of view
+    inline STraversalResult VisitChildState(TState& childState, size_t const ply, size_t const depth, float const alpha, float const beta, size_t const moveIndex)
+    {
+        size_t const reduction = GetLateMoveReduction(depth, moveIndex);
+        if (moveIndex == 0 || (!m_config.m_usePrincipalVariationSearch && reduction == 0))
+            return VisitState(childState, ply, depth, -beta, -alpha);
+
+        // a window narrower than 2 * epsilon is already closed by the cutoff condition
+        float const nullWindowBeta = alpha + 2.0f * m_config.m_epsilon;
+        auto result = VisitState(childState, ply, depth - reduction, -nullWindowBeta, -alpha);
+        float score = -result.m_score;
+        if (reduction > 0)
+        {
+            m_debugInfo.ReduceLateMove();
+            if (score <= alpha + m_config.m_epsilon || m_isStopRequested)
+                return result;
+
+            // the reduced search failed high, verify it with the full depth
+            m_debugInfo.ResearchLateMove();
+            if (!m_config.m_usePrincipalVariationSearch)
+                return VisitState(childState, ply, depth, -beta, -alpha);
+            result = VisitState(childState, ply, depth, -nullWindowBeta, -alpha);
+            score = -result.m_score;
+        }
+        if (score > alpha + m_config.m_epsilon && score + m_config.m_epsilon < beta && !m_isStopRequested)
+        {
+            m_debugInfo.ResearchNullWindow();
+            return VisitState(childState, ply, depth, -beta, -alpha);
+        }
         return result;
     }
 
+    inline TranspositionTable& GetTranspositionTable()
+    {
+        return m_sharedTranspositionTable != nullptr ? *m_sharedTranspositionTable : m_ownTranspositionTable;
+    }
+
+    inline bool IsTranspositionCutoff(typename TranspositionTable::SEntry const& entry, float const alpha, float const beta) const
+    {
+        switch (entry.m_bound)
+        {
+        case ETranspositionBound::Exact: return true;
+        case ETranspositionBound::Lower: return entry.m_score + m_config.m_epsilon >= beta;
+        case ETranspositionBound::Upper: return entry.m_score <= alpha;
+        }
+        return false;
+    }
+
+    // the hash of the canonical state if TResolver knows the symmetries of the game,
+    // symmetryOut then maps the moves of the state to the moves of the canonical state
+    inline uint64_t GetStateHash(TState const& state, size_t& symmetryOut)
+    {
+        if constexpr (HasSymmetries<TResolver, TState, TMove>)
+        {
+            TState canonicalState;
+            symmetryOut = m_resolver.CanonicalizeState(state, canonicalState);
+            return m_resolver.GetHash(canonicalState);
+        }
+        else
+        {
+            symmetryOut = 0;
+            return m_resolver.GetHash(state);
+        }
+    }
+
+    // the moves are stored for the canonical state and restored for the probed one
+    inline bool ProbeTransposition(uint64_t const hash, size_t const symmetry, typename TranspositionTable::SEntry& entryOut)
+    {
+        if (!GetTranspositionTable().Probe(hash, entryOut))
+            return false;
+        if constexpr (HasSymmetries<TResolver, TState, TMove>)
+        {
+            if (entryOut.m_hasMove)
+                entryOut.m_move = m_resolver.RestoreMove(entryOut.m_move, symmetry);
+        }
+        return true;
+    }
+
+    inline bool ProbeTransposition(TState const& state, typename TranspositionTable::SEntry& entryOut)
+    {
+        size_t symmetry = 0;
+        uint64_t const hash = GetStateHash(state, symmetry);
+        return ProbeTransposition(hash, symmetry, entryOut);
+    }
+
+    inline void StoreTransposition(uint64_t const hash, size_t const symmetry, STraversalResult const& result, size_t const remainingDepth, float const alpha, float const beta)
+    {
+        ETranspositionBound const bound = (result.m_score <= alpha)
+            ? ETranspositionBound::Upper
+            : (result.m_score + m_config.m_epsilon >= beta) ? ETranspositionBound::Lower : ETranspositionBound::Exact;
+        TMove canonicalMove = result.m_move;
+        if constexpr (HasSymmetries<TResolver, TState, TMove>)
+        {
+            if (bound != ETranspositionBound::Upper)
+                canonicalMove = m_resolver.TransformMove(result.m_move, symmetry);
+        }
+        // a fail-low node has no reliable best move
+        TMove const* move = (bound == ETranspositionBound::Upper) ? nullptr : &canonicalMove;
+        bool const isCollision = GetTranspositionTable().Store(hash, result.m_score, remainingDepth, bound, move);
+        if (isCollision)
+            m_debugInfo.CollideTransposition();
+    }
+
+    inline bool IsMoveOrderingEnabled() const
+    {
+        return m_config.m_useKillerMoves || !m_historyTable.empty();
+    }
+
+    inline size_t GetHistoryIndex(TMove const& move, size_t const ply)
+    {
+        if constexpr (HasGetMoveIndex<TResolver, TMove>)
+        {
+            size_t const moveIndex = m_resolver.GetMoveIndex(move);
+            assert(moveIndex < m_config.m_moveIndicesCount);
+            return (ply & 1) * m_config.m_moveIndicesCount + moveIndex;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    inline size_t GetOrderingScore(TMove const& move, size_t const ply)
+    {
+        if (ply < m_killerMoves.size())
+        {
+            auto const& killers = m_killerMoves[ply];
+            for (size_t i = 0; i < killers.m_count; ++i)
+            {
+                if (killers.m_moves[i] == move)
+                    return std::numeric_limits<size_t>::max() - i;
+            }
+        }
+        return m_historyTable.empty() ? 0 : m_historyTable[GetHistoryIndex(move, ply)];
+    }
+
+    // stable insertion sort by descending ordering score, the moves lists are short
+    void SortMoves(TMovesContainer& moves, size_t const ply)
+    {
+        if (ply >= m_orderingScores.size()) return;
+
+        auto& scores = m_orderingScores[ply];
+        scores.resize(moves.size());
+        for (size_t i = 0; i < moves.size(); ++i)
+        {
+            size_t const score = GetOrderingScore(moves[i], ply);
+            size_t j = i;
+            for (; j > 0 && scores[j - 1] < score; --j)
+            {
+                scores[j] = scores[j - 1];
+                std::swap(moves[j], moves[j - 1]);
+            }
+            scores[j] = score;
+        }
+    }
+
+    void RegisterCutoffMove(TMove const& move, size_t const ply, size_t const depth)
+    {
+        if (ply < m_killerMoves.size())
+        {
+            auto& killers = m_killerMoves[ply];
+            if (killers.m_count == 0 || !(killers.m_moves[0] == move))
+            {
+                for (size_t i = SKillerMoves::SLOTS_COUNT - 1; i > 0; --i)
+                {
+                    killers.m_moves[i] = killers.m_moves[i - 1];
+                }
+                killers.m_moves[0] = move;
+                killers.m_count = (killers.m_count < SKillerMoves::SLOTS_COUNT) ? killers.m_count + 1 : killers.m_count;
+            }
+        }
+        if (!m_historyTable.empty())
+        {
+            m_historyTable[GetHistoryIndex(move, ply)] += depth * depth;
+        }
+    }
+
+    static inline void MoveToFront(TMovesContainer& moves, TMove const& move)
+    {
+        for (size_t i = 0; i < moves.size(); ++i)
+        {
+            if (moves[i] == move)
+            {
+                for (; i > 0; --i)
+                {
+                    std::swap(moves[i], moves[i - 1]);
+                }
+                return;
+            }
+        }
+    }
+
 private:
     TResolver m_resolver;
     SConfig m_config;
-#if MIMAX_MINIMAX_DEBUG
-    SMinimaxDebugInfo m_debugInfo;
-#endif // MIMAX_MINIMAX_DEBUG
-    bool m_isStopRequested;
+    TranspositionTable m_ownTranspositionTable;
+    TranspositionTable* m_sharedTranspositionTable;
+    std::vector<size_t> m_historyTable;
+    std::vector<SKillerMoves> m_killerMoves;
+    std::vector<std::vector<size_t>> m_orderingScores;
+    TMove m_rootMoveHint;
+    bool m_hasRootMoveHint = false;
+    bool m_isInNullMoveSearch = false;
+    std::vector<AccumulatorOf<TResolver>> m_accumulators;
+    std::vector<TState> m_frontierStates;
+    std::vector<float> m_frontierScores;
+    std::vector<size_t> m_frontierMoveIndices;
+    std::vector<STraversalResult> m_frontierMoveResults;
+    std::future<void> m_ponderingFuture;
+    CTablebase const* m_tablebase = nullptr;
+    COpeningBook const* m_openingBook = nullptr;
+    CSearchLimiter m_limiter;
+    TStatistics m_debugInfo;
+    std::atomic<bool> m_isStopRequested;
+    std::atomic<size_t> m_stopRequestsCnt;
 };
 
 } // dma
@@ -1,15 +1,15 @@
 #include "Mimax_PCH.h"
 #include "mimax/dma/MinimaxDebugInfo.h"
 
-#if MIMAX_MINIMAX_DEBUG
 namespace mimax {
 namespace dma {
 
 std::ostream& operator<<(std::ostream& o, SMinimaxDebugInfo const& debugInfo)
 {
-    size_t const mxDepth = debugInfo.m_maxDepth > SMinimaxDebugInfo::MAX_DEPTH
-        ? SMinimaxDebugInfo::MAX_DEPTH
-        : debugInfo.m_maxDepth + 1;
+    // the per depth arrays have MAX_DEPTH + 1 entries
+    size_t const mxDepth = debugInfo.m_maxDepth < SMinimaxDebugInfo::MAX_DEPTH
+        ? debugInfo.m_maxDepth + 1
+        : SMinimaxDebugInfo::MAX_DEPTH;
 
     o << "Evaluated nodes count: " << debugInfo.m_evaluatedNodesCnt << "\n";
 
@@ -25,9 +25,97 @@ std::ostream& operator<<(std::ostream& o, SMinimaxDebugInfo const& debugInfo)
         o << depth << ": " << debugInfo.m_prunedNodesCnt[depth] << "\n";
     }
 
+    o << "Transposition hits count: " << debugInfo.m_transpositionHitsCnt << "\n";
+    o << "Transposition collisions count: " << debugInfo.m_transpositionCollisionsCnt << "\n";
+    o << "Null window researches count: " << debugInfo.m_nullWindowResearchesCnt << "\n";
+    o << "Aspiration window researches count: " << debugInfo.m_aspirationResearchesCnt << "\n";
+    o << "Quiescence nodes count: " << debugInfo.m_quiescenceNodesCnt << "\n";
+    o << "Null move cutoffs count: " << debugInfo.m_nullMoveCutoffsCnt << "\n";
+    o << "Late move reductions count: " << debugInfo.m_lateMoveReductionsCnt << "\n";
+    o << "Late move researches count: " << debugInfo.m_lateMoveResearchesCnt << "\n";
+    o << "Evaluated batches count: " << debugInfo.m_evaluatedBatchesCnt << "\n";
+    o << "Tablebase hits count: " << debugInfo.m_tablebaseHitsCnt << "\n";
+    o << "Chance node cutoffs count: " << debugInfo.m_chanceCutoffsCnt << "\n";
+    o << "MTD(f) zero window searches count: " << debugInfo.m_zeroWindowSearchesCnt << "\n";
+    o << "Branching factor: " << debugInfo.GetBranchingFactor() << "\n";
+
+    o << "Cutoffs by move index: \n";
+    for (size_t i = 0; i <= SMinimaxDebugInfo::MAX_CUTOFF_MOVE_INDEX; ++i)
+    {
+        o << i << (i == SMinimaxDebugInfo::MAX_CUTOFF_MOVE_INDEX ? "+" : "") << ": " << debugInfo.m_cutoffMoveIndicesCnt[i] << "\n";
+    }
+
+    o << "Depth times: \n";
+    for (size_t depth = 1; depth <= mxDepth; ++depth)
+    {
+        o << depth << ": " << debugInfo.m_depthTimes[depth] << "s\n";
+    }
+
+    return o;
+}
+
+template<typename T>
+static void WriteJsonArray(std::ostream& o, char const* name, T const* values, size_t const count)
+{
+    o << "\"" << name << "\":[";
+    for (size_t i = 0; i < count; ++i)
+    {
+        o << (i > 0 ? "," : "") << values[i];
+    }
+    o << "]";
+}
+
+std::ostream& WriteJson(std::ostream& o, SMinimaxDebugInfo const& debugInfo)
+{
+    size_t const depthsCnt = (debugInfo.m_maxDepth < SMinimaxDebugInfo::MAX_DEPTH ? debugInfo.m_maxDepth : SMinimaxDebugInfo::MAX_DEPTH) + 1;
+
+    o << "{";
+    o << "\"evaluatedNodes\":" << debugInfo.m_evaluatedNodesCnt << ",";
+    o << "\"visitedNodes\":" << debugInfo.m_totalVisitedNodesCnt << ",";
+    WriteJsonArray(o, "visitedNodesPerDepth", debugInfo.m_visitedNodesCnt, depthsCnt);
+    o << ",";
+    o << "\"prunedNodes\":" << debugInfo.m_totalPrunedNodesCnt << ",";
+    WriteJsonArray(o, "prunedNodesPerDepth", debugInfo.m_prunedNodesCnt, depthsCnt);
+    o << ",";
+    o << "\"maxDepth\":" << debugInfo.m_maxDepth << ",";
+    o << "\"transpositionHits\":" << debugInfo.m_transpositionHitsCnt << ",";
+    o << "\"transpositionCollisions\":" << debugInfo.m_transpositionCollisionsCnt << ",";
+    o << "\"nullWindowResearches\":" << debugInfo.m_nullWindowResearchesCnt << ",";
+    o << "\"aspirationResearches\":" << debugInfo.m_aspirationResearchesCnt << ",";
+    o << "\"quiescenceNodes\":" << debugInfo.m_quiescenceNodesCnt << ",";
+    o << "\"nullMoveCutoffs\":" << debugInfo.m_nullMoveCutoffsCnt << ",";
+    o << "\"lateMoveReductions\":" << debugInfo.m_lateMoveReductionsCnt << ",";
+    o << "\"lateMoveResearches\":" << debugInfo.m_lateMoveResearchesCnt << ",";
+    o << "\"evaluatedBatches\":" << debugInfo.m_evaluatedBatchesCnt << ",";
+    o << "\"tablebaseHits\":" << debugInfo.m_tablebaseHitsCnt << ",";
+    o << "\"chanceCutoffs\":" << debugInfo.m_chanceCutoffsCnt << ",";
+    o << "\"zeroWindowSearches\":" << debugInfo.m_zeroWindowSearchesCnt << ",";
+    o << "\"expandedNodes\":" << debugInfo.m_expandedNodesCnt << ",";
+    o << "\"branchingFactor\":" << debugInfo.GetBranchingFactor() << ",";
+    WriteJsonArray(o, "cutoffMoveIndices", debugInfo.m_cutoffMoveIndicesCnt, SMinimaxDebugInfo::MAX_CUTOFF_MOVE_INDEX + 1);
+    o << ",";
+    WriteJsonArray(o, "depthTimes", debugInfo.m_depthTimes, depthsCnt);
+    o << "}";
+
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, SMinimaxParallelDebugInfo const& debugInfo)
+{
+    o << "Visited nodes count: " << debugInfo.m_visitedNodesCnt << "\n";
+    o << "Split points count: " << debugInfo.m_splitPointsCnt << "\n";
+    o << "Split point cutoffs count: " << debugInfo.m_splitPointCutoffsCnt << "\n";
+    o << "Search time: " << debugInfo.m_searchTime << "s\n";
+    if (debugInfo.HasSerialBaseline())
+    {
+        o << "Serial visited nodes count: " << debugInfo.m_serialVisitedNodesCnt << "\n";
+        o << "Serial search time: " << debugInfo.m_serialSearchTime << "s\n";
+        o << "Speedup: " << debugInfo.GetSpeedup() << "\n";
+        o << "Search overhead: " << debugInfo.GetSearchOverhead() << "\n";
+    }
+
     return o;
 }
 
 } // dma
 } // mimax
-#endif // MIMAX_MINIMAX_DEBUG
\ No newline at end of file
@@ -1,16 +1,46 @@
 #pragma once
 
-#define MIMAX_MINIMAX_DEBUG (1)
-
-#if MIMAX_MINIMAX_DEBUG
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <iostream>
 
 namespace mimax {
 namespace dma {
 
+// Statistics policy of the minimax searches which collects nothing, every call compiles to nothing.
+struct SNoMinimaxStatistics
+{
+    inline void EvaluateNode() {}
+    inline void VisitNode(size_t const) {}
+    inline void ExpandNode(size_t const) {}
+    inline void PruneNodes(size_t const, size_t const) {}
+    inline void CutoffMove(size_t const) {}
+    inline void HitTransposition() {}
+    inline void CollideTransposition() {}
+    inline void VisitQuiescenceNode() {}
+    inline void CutoffNullMove() {}
+    inline void ReduceLateMove() {}
+    inline void ResearchLateMove() {}
+    inline void EvaluateBatch() {}
+    inline void HitTablebase() {}
+    inline void CutoffChanceNode() {}
+    inline void SearchZeroWindow() {}
+    inline void ResearchNullWindow() {}
+    inline void ResearchAspirationWindow() {}
+    inline void StartDepth(size_t const) {}
+    inline void FinishDepth(size_t const) {}
+    inline void Reset() {}
+};
+
+// Statistics policy of the minimax searches which counts everything.
 struct SMinimaxDebugInfo
 {
+    using Clock = std::chrono::steady_clock;
+
     static constexpr size_t MAX_DEPTH = 64;
+    // cutoffs by later moves are counted together in the last entry of m_cutoffMoveIndicesCnt
+    static constexpr size_t MAX_CUTOFF_MOVE_INDEX = 16;
 
     size_t m_evaluatedNodesCnt;
     size_t m_visitedNodesCnt[MAX_DEPTH + 1];
@@ -18,6 +48,24 @@ struct SMinimaxDebugInfo
     size_t m_prunedNodesCnt[MAX_DEPTH + 1];
     size_t m_totalPrunedNodesCnt;
     size_t m_maxDepth;
+    size_t m_transpositionHitsCnt;
+    size_t m_transpositionCollisionsCnt;
+    size_t m_nullWindowResearchesCnt;
+    size_t m_aspirationResearchesCnt;
+    size_t m_quiescenceNodesCnt;
+    size_t m_nullMoveCutoffsCnt;
+    size_t m_lateMoveReductionsCnt;
+    size_t m_lateMoveResearchesCnt;
+    size_t m_evaluatedBatchesCnt;
+    size_t m_tablebaseHitsCnt;
+    size_t m_chanceCutoffsCnt;
+    size_t m_zeroWindowSearchesCnt;
+    size_t m_expandedNodesCnt;
+    size_t m_generatedMovesCnt;
+    size_t m_cutoffMoveIndicesCnt[MAX_CUTOFF_MOVE_INDEX + 1];
+    // seconds spent by every completed iterative deepening depth
+    double m_depthTimes[MAX_DEPTH + 1];
+    Clock::time_point m_depthStartTime;
 
     SMinimaxDebugInfo()
     {
@@ -37,6 +85,12 @@ struct SMinimaxDebugInfo
             ++m_visitedNodesCnt[depth];
     }
 
+    inline void ExpandNode(size_t const movesCnt)
+    {
+        ++m_expandedNodesCnt;
+        m_generatedMovesCnt += movesCnt;
+    }
+
     inline void PruneNodes(size_t const nodesCnt, size_t const depth)
     {
         m_totalPrunedNodesCnt += nodesCnt;
@@ -44,19 +98,188 @@ struct SMinimaxDebugInfo
             m_prunedNodesCnt[depth] += nodesCnt;
     }
 
+    inline void CutoffMove(size_t const moveIndex)
+    {
+        ++m_cutoffMoveIndicesCnt[moveIndex < MAX_CUTOFF_MOVE_INDEX ? moveIndex : MAX_CUTOFF_MOVE_INDEX];
+    }
+
+    inline void HitTransposition()
+    {
+        ++m_transpositionHitsCnt;
+    }
+
+    inline void CollideTransposition()
+    {
+        ++m_transpositionCollisionsCnt;
+    }
+
+    inline void VisitQuiescenceNode()
+    {
+        ++m_quiescenceNodesCnt;
+    }
+
+    inline void CutoffNullMove()
+    {
+        ++m_nullMoveCutoffsCnt;
+    }
+
+    inline void ReduceLateMove()
+    {
+        ++m_lateMoveReductionsCnt;
+    }
+
+    inline void ResearchLateMove()
+    {
+        ++m_lateMoveResearchesCnt;
+    }
+
+    inline void EvaluateBatch()
+    {
+        ++m_evaluatedBatchesCnt;
+    }
+
+    inline void HitTablebase()
+    {
+        ++m_tablebaseHitsCnt;
+    }
+
+    inline void CutoffChanceNode()
+    {
+        ++m_chanceCutoffsCnt;
+    }
+
+    inline void SearchZeroWindow()
+    {
+        ++m_zeroWindowSearchesCnt;
+    }
+
+    inline void ResearchNullWindow()
+    {
+        ++m_nullWindowResearchesCnt;
+    }
+
+    inline void ResearchAspirationWindow()
+    {
+        ++m_aspirationResearchesCnt;
+    }
+
+    inline void StartDepth(size_t const)
+    {
+        m_depthStartTime = Clock::now();
+    }
+
+    inline void FinishDepth(size_t const depth)
+    {
+        if (depth <= MAX_DEPTH)
+            m_depthTimes[depth] = std::chrono::duration<double>(Clock::now() - m_depthStartTime).count();
+    }
+
+    // average moves count of the states whose moves were generated
+    inline double GetBranchingFactor() const
+    {
+        return m_expandedNodesCnt > 0 ? (double)m_generatedMovesCnt / (double)m_expandedNodesCnt : 0.0;
+    }
+
     inline void Reset()
     {
         m_evaluatedNodesCnt = 0;
         m_totalVisitedNodesCnt = 0;
         m_totalPrunedNodesCnt = 0;
         m_maxDepth = 0;
+        m_transpositionHitsCnt = 0;
+        m_transpositionCollisionsCnt = 0;
+        m_nullWindowResearchesCnt = 0;
+        m_aspirationResearchesCnt = 0;
+        m_quiescenceNodesCnt = 0;
+        m_nullMoveCutoffsCnt = 0;
+        m_lateMoveReductionsCnt = 0;
+        m_lateMoveResearchesCnt = 0;
+        m_evaluatedBatchesCnt = 0;
+        m_tablebaseHitsCnt = 0;
+        m_chanceCutoffsCnt = 0;
+        m_zeroWindowSearchesCnt = 0;
+        m_expandedNodesCnt = 0;
+        m_generatedMovesCnt = 0;
         memset(m_visitedNodesCnt, 0, sizeof(m_visitedNodesCnt));
         memset(m_prunedNodesCnt, 0, sizeof(m_prunedNodesCnt));
+        memset(m_cutoffMoveIndicesCnt, 0, sizeof(m_cutoffMoveIndicesCnt));
+        std::fill(m_depthTimes, m_depthTimes + MAX_DEPTH + 1, 0.0);
     }
 };
 
 std::ostream& operator<<(std::ostream& o, SMinimaxDebugInfo const& debugInfo);
+// one JSON object with all the counters, the per depth arrays are indexed by the distance from the root
+std::ostream& WriteJson(std::ostream& o, SMinimaxDebugInfo const& debugInfo);
+
+// Statistics policy of CMinimaxYBW which collects nothing.
+struct SNoMinimaxParallelStatistics
+{
+    inline void SplitNode(bool const) {}
+    inline void FinishSearch(size_t const, double const) {}
+    inline void FinishSerialSearch(size_t const, double const) {}
+    inline void Reset() {}
+};
+
+// Statistics policy of CMinimaxYBW which counts split points and compares the search with a serial one.
+struct SMinimaxParallelDebugInfo
+{
+    size_t m_visitedNodesCnt;
+    size_t m_splitPointsCnt;
+    size_t m_splitPointCutoffsCnt;
+    double m_searchTime;
+    // filled only when the serial baseline search is requested
+    size_t m_serialVisitedNodesCnt;
+    double m_serialSearchTime;
+
+    SMinimaxParallelDebugInfo()
+    {
+        Reset();
+    }
+
+    inline void SplitNode(bool const isCutoff)
+    {
+        ++m_splitPointsCnt;
+        if (isCutoff)
+            ++m_splitPointCutoffsCnt;
+    }
+
+    inline void FinishSearch(size_t const visitedNodesCnt, double const searchTime)
+    {
+        m_visitedNodesCnt = visitedNodesCnt;
+        m_searchTime = searchTime;
+    }
+
+    inline void FinishSerialSearch(size_t const visitedNodesCnt, double const searchTime)
+    {
+        m_serialVisitedNodesCnt = visitedNodesCnt;
+        m_serialSearchTime = searchTime;
+    }
+
+    inline bool HasSerialBaseline() const { return m_serialVisitedNodesCnt > 0; }
+
+    inline double GetSpeedup() const
+    {
+        return m_searchTime > 0.0 ? m_serialSearchTime / m_searchTime : 0.0;
+    }
+
+    // extra nodes visited by the parallel search relative to the serial one
+    inline double GetSearchOverhead() const
+    {
+        return HasSerialBaseline() ? (double)m_visitedNodesCnt / (double)m_serialVisitedNodesCnt - 1.0 : 0.0;
+    }
+
+    inline void Reset()
+    {
+        m_visitedNodesCnt = 0;
+        m_splitPointsCnt = 0;
+        m_splitPointCutoffsCnt = 0;
+        m_searchTime = 0.0;
+        m_serialVisitedNodesCnt = 0;
+        m_serialSearchTime = 0.0;
+    }
+};
+
+std::ostream& operator<<(std::ostream& o, SMinimaxParallelDebugInfo const& debugInfo);
 
 } // dma
 } // mimax
-#endif // MIMAX_MINIMAX_DEBUG
\ No newline at end of file
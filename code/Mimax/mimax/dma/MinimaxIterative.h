@@ -0,0 +1,272 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "mimax/dma/MinimaxDebugInfo.h"
+#include "mimax/dma/MinimaxResolverTraits.h"
+#include "mimax/dma/TranspositionTable.h"
+
+namespace mimax {
+namespace dma {
+
+/*
+Alpha-beta negamax without recursion: the search walks an explicit stack of frames, one per ply.
+The states, move containers and frames of all plies are allocated once by the constructor and
+reused by every search, so a steady state search doesn't allocate (as long as GetPossibleMoves
+stays within the capacity the containers already reached).
+
+TMove, TResolver and TStatistics as for CMinimaxBase, of the optional hooks only GetHash is used.
+TState is additionally default constructible.
+TMovesContainer as for CMinimaxBase, plus
+    void clear()
+*/
+
+template<typename TState, typename TMove, typename TMovesContainer, typename TResolver, typename TStatistics = SNoMinimaxStatistics>
+class CMinimaxIterative
+{
+public:
+    using State = TState;
+    using Move = TMove;
+    using TranspositionTable = CTranspositionTable<TMove>;
+
+public:
+    struct SConfig
+    {
+        float m_minValue = -1.0f;
+        float m_maxValue = 1.0f;
+        float m_epsilon = std::numeric_limits<float>::epsilon();
+        size_t m_maxDepth = 0;
+        // entries of the transposition table, used only if TResolver provides GetHash
+        size_t m_transpositionTableSize = 0;
+    };
+
+    struct SSearchResult
+    {
+        std::optional<TMove> m_move;
+        float m_score = 0.0f;
+    };
+
+public:
+    CMinimaxIterative(TResolver const& resolver, SConfig const& config)
+        : m_resolver(resolver)
+        , m_config(config)
+        , m_states(config.m_maxDepth + 1)
+        , m_moves(config.m_maxDepth + 1)
+        , m_frames(config.m_maxDepth + 1)
+        , m_isStopRequested(false)
+    {
+        if constexpr (HasGetHash<TResolver, TState>)
+        {
+            m_transpositionTable.Resize(m_config.m_transpositionTableSize);
+        }
+    }
+
+    inline std::optional<TMove> FindSolution(TState const& state)
+    {
+        return Search(state).m_move;
+    }
+
+    SSearchResult Search(TState const& state)
+    {
+        m_debugInfo.Reset();
+        m_transpositionTable.Clear();
+
+        m_states[0] = state;
+        size_t ply = 0;
+        bool isResolved = EnterState(0, m_config.m_maxDepth, m_config.m_minValue, m_config.m_maxValue);
+        while (true)
+        {
+            SFrame& frame = m_frames[ply];
+            if (!isResolved)
+            {
+                if (frame.m_moveIndex < m_moves[ply].size() && !frame.m_isCutoff && !m_isStopRequested)
+                {
+                    m_states[ply + 1] = m_states[ply];
+                    m_resolver.MakeMove(m_states[ply + 1], m_moves[ply][frame.m_moveIndex]);
+                    ++ply;
+                    isResolved = EnterState(ply, frame.m_depth - 1, -frame.m_beta, -frame.m_alpha);
+                    continue;
+                }
+                LeaveState(ply);
+            }
+
+            if (ply == 0) break;
+
+            float const score = -frame.m_score;
+            --ply;
+            ReturnToParent(ply, score);
+            isResolved = false;
+        }
+
+        SSearchResult result;
+        // a stopped search leaves the scores of the unwound frames unbounded, so it has no move
+        if (!m_isStopRequested)
+        {
+            result.m_score = m_frames[0].m_score;
+            if (m_frames[0].m_hasMove)
+                result.m_move = m_frames[0].m_move;
+        }
+        m_isStopRequested = false;
+        return result;
+    }
+
+    inline void StopAlgorithm() { m_isStopRequested = true; }
+
+    inline TStatistics const& GetDebugInfo() const { return m_debugInfo; }
+
+private:
+    struct SFrame
+    {
+        size_t m_depth = 0;
+        float m_alpha = 0.0f;
+        float m_beta = 0.0f;
+        float m_initialAlpha = 0.0f;
+        float m_score = 0.0f;
+        size_t m_moveIndex = 0;
+        uint64_t m_hash = 0;
+        bool m_isCutoff = false;
+        bool m_hasMove = false;
+        TMove m_move{};
+    };
+
+private:
+    // prepares the frame of the state at ply, returns true if the state is resolved without visiting children
+    bool EnterState(size_t const ply, size_t const depth, float const alpha, float const beta)
+    {
+        m_debugInfo.VisitNode(ply);
+        SFrame& frame = m_frames[ply];
+        TState const& state = m_states[ply];
+        frame.m_depth = depth;
+        frame.m_alpha = alpha;
+        frame.m_beta = beta;
+        frame.m_initialAlpha = alpha;
+        frame.m_score = -std::numeric_limits<float>::max();
+        frame.m_moveIndex = 0;
+        frame.m_isCutoff = false;
+        frame.m_hasMove = false;
+
+        bool hasHashMove = false;
+        TMove hashMove{};
+        if constexpr (HasGetHash<TResolver, TState>)
+        {
+            typename TranspositionTable::SEntry entry;
+            if (m_transpositionTable.IsEnabled())
+            {
+                frame.m_hash = m_resolver.GetHash(state);
+                if (m_transpositionTable.Probe(frame.m_hash, entry))
+                {
+                    m_debugInfo.HitTransposition();
+                    hasHashMove = entry.m_hasMove;
+                    hashMove = entry.m_move;
+                    if (ply > 0 && entry.m_depth >= depth && IsTranspositionCutoff(entry, alpha, beta))
+                    {
+                        frame.m_score = entry.m_score;
+                        return true;
+                    }
+                }
+            }
+        }
+
+        auto& moves = m_moves[ply];
+        moves.clear();
+        if (depth > 0)
+        {
+            m_resolver.GetPossibleMoves(moves, state);
+        }
+        if (moves.empty())
+        {
+            m_debugInfo.EvaluateNode();
+            int const colorMultiplier = (ply & 1) == 0 ? 1 : -1;
+            frame.m_score = m_resolver.EvaluateState(state) * colorMultiplier;
+            return true;
+        }
+
+        if (hasHashMove)
+        {
+            MoveToFront(moves, hashMove);
+        }
+        return false;
+    }
+
+    void ReturnToParent(size_t const ply, float const childScore)
+    {
+        SFrame& frame = m_frames[ply];
+        auto const& moves = m_moves[ply];
+        if (childScore > frame.m_score)
+        {
+            frame.m_score = childScore;
+            frame.m_move = moves[frame.m_moveIndex];
+            frame.m_hasMove = true;
+            frame.m_alpha = (childScore > frame.m_alpha) ? childScore : frame.m_alpha;
+            if (frame.m_alpha + m_config.m_epsilon >= frame.m_beta)
+            {
+                m_debugInfo.PruneNodes(moves.size() - (frame.m_moveIndex + 1), ply + 1);
+                frame.m_isCutoff = true;
+            }
+        }
+        ++frame.m_moveIndex;
+    }
+
+    void LeaveState(size_t const ply)
+    {
+        if constexpr (HasGetHash<TResolver, TState>)
+        {
+            SFrame const& frame = m_frames[ply];
+            if (!m_transpositionTable.IsEnabled() || m_isStopRequested || !frame.m_hasMove)
+                return;
+
+            ETranspositionBound const bound = (frame.m_score <= frame.m_initialAlpha)
+                ? ETranspositionBound::Upper
+                : (frame.m_score + m_config.m_epsilon >= frame.m_beta) ? ETranspositionBound::Lower : ETranspositionBound::Exact;
+            // a fail-low node has no reliable best move
+            TMove const* move = (bound == ETranspositionBound::Upper) ? nullptr : &frame.m_move;
+            bool const isCollision = m_transpositionTable.Store(frame.m_hash, frame.m_score, frame.m_depth, bound, move);
+            if (isCollision)
+                m_debugInfo.CollideTransposition();
+        }
+    }
+
+    inline bool IsTranspositionCutoff(typename TranspositionTable::SEntry const& entry, float const alpha, float const beta) const
+    {
+        switch (entry.m_bound)
+        {
+        case ETranspositionBound::Exact: return true;
+        case ETranspositionBound::Lower: return entry.m_score + m_config.m_epsilon >= beta;
+        case ETranspositionBound::Upper: return entry.m_score <= alpha;
+        }
+        return false;
+    }
+
+    static inline void MoveToFront(TMovesContainer& moves, TMove const& move)
+    {
+        for (size_t i = 0; i < moves.size(); ++i)
+        {
+            if (moves[i] == move)
+            {
+                for (; i > 0; --i)
+                {
+                    std::swap(moves[i], moves[i - 1]);
+                }
+                return;
+            }
+        }
+    }
+
+private:
+    TResolver m_resolver;
+    SConfig m_config;
+    TranspositionTable m_transpositionTable;
+    std::vector<TState> m_states;
+    std::vector<TMovesContainer> m_moves;
+    std::vector<SFrame> m_frames;
+    TStatistics m_debugInfo;
+    std::atomic<bool> m_isStopRequested;
+};
+
+} // dma
+} // mimax
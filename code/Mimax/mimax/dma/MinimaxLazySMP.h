@@ -0,0 +1,123 @@
+#pragma once
+
+#include <future>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "mimax/dma/MinimaxBase.h"
+
+namespace mimax {
+namespace dma {
+
+/*
+Lazy SMP: several CMinimaxBase searchers run the same iterative deepening search on one state
+and communicate only through a shared transposition table. The helpers start at alternating depths
+and with rotated root moves, so they fill the table with different subtrees which the main
+searcher then reuses. The result of the main searcher is returned.
+
+TResolver must provide GetHash(TState const&), see CMinimaxBase. TMove must satisfy
+IsSharedTranspositionMove, the shared table copies the entries without locks.
+*/
+
+template<typename TState, typename TMove, typename TMovesContainer, typename TResolver>
+class CMinimaxLazySMP
+{
+public:
+    using Minimax = CMinimaxBase<TState, TMove, TMovesContainer, TResolver>;
+    using State = TState;
+    using Move = TMove;
+    using SSearchResult = typename Minimax::SSearchResult;
+
+    static_assert(HasGetHash<TResolver, TState>, "Lazy SMP requires TResolver::GetHash");
+    static_assert(IsSharedTranspositionMove<TMove>, "the shared transposition table requires a plain data TMove");
+
+public:
+    struct SConfig
+    {
+        // m_useIterativeDeepening is forced for all searchers
+        typename Minimax::SConfig m_minimaxConfig;
+        // main searcher included; 0 uses all hardware threads
+        size_t m_threadsCount = 0;
+    };
+
+public:
+    CMinimaxLazySMP(TResolver const& resolver, SConfig const& config)
+        : m_config(config.m_minimaxConfig)
+        , m_transpositionTable(config.m_minimaxConfig.m_transpositionTableSize)
+    {
+        size_t threadsCount = config.m_threadsCount > 0
+            ? config.m_threadsCount
+            : static_cast<size_t>(std::thread::hardware_concurrency());
+        threadsCount = threadsCount > 0 ? threadsCount : 1;
+
+        m_searchers.reserve(threadsCount);
+        for (size_t i = 0; i < threadsCount; ++i)
+        {
+            auto minimaxConfig = m_config;
+            minimaxConfig.m_useIterativeDeepening = true;
+            minimaxConfig.m_minDepth = 1 + (i & 1);
+            minimaxConfig.m_rootMovesRotation = i / 2;
+            m_searchers.emplace_back(std::make_unique<Minimax>(resolver, minimaxConfig, &m_transpositionTable));
+        }
+    }
+
+    inline std::optional<TMove> FindSolution(TState const& state)
+    {
+        return Search(state).m_move;
+    }
+
+    inline SSearchResult Search(TState const& state)
+    {
+        return Search(state, SSearchLimits());
+    }
+
+    // limits apply to the main searcher, the helpers are stopped when it returns
+    SSearchResult Search(TState const& state, SSearchLimits const& limits)
+    {
+        if (m_config.m_keepSearchData)
+            m_transpositionTable.NextGeneration();
+        else
+            m_transpositionTable.Clear();
+
+        std::vector<std::future<void>> helpers;
+        helpers.reserve(m_searchers.size() - 1);
+        for (size_t i = 1; i < m_searchers.size(); ++i)
+        {
+            Minimax* helper = m_searchers[i].get();
+            helper->ResetStopRequest();
+            helpers.emplace_back(std::async(std::launch::async, [helper, &state]()
+                {
+                    helper->Search(state);
+                }));
+        }
+
+        auto const result = m_searchers[0]->Search(state, limits);
+
+        for (size_t i = 1; i < m_searchers.size(); ++i)
+        {
+            m_searchers[i]->StopAlgorithm();
+        }
+        for (auto& helper : helpers)
+        {
+            helper.wait();
+        }
+        return result;
+    }
+
+    inline void StopAlgorithm() { m_searchers[0]->StopAlgorithm(); }
+    // see CMinimaxBase::ResetStopRequest, the helpers are reset by Search
+    inline void ResetStopRequest() { m_searchers[0]->ResetStopRequest(); }
+
+    inline size_t GetSearchersCount() const { return m_searchers.size(); }
+    inline Minimax const& GetSearcher(size_t const index) const { return *m_searchers[index]; }
+
+private:
+    typename Minimax::SConfig m_config;
+    typename Minimax::TranspositionTable m_transpositionTable;
+    std::vector<std::unique_ptr<Minimax>> m_searchers;
+};
+
+} // dma
+} // mimax
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mimax {
+namespace dma {
+
+// Compile-time detection of the optional TResolver hooks used by the minimax search.
+
+// placeholder accumulator of resolvers which evaluate states from scratch
+struct SNoAccumulator {};
+
+namespace details {
+
+template<typename TResolver, typename TState, typename = void>
+struct SHasGetHash : std::false_type {};
+
+template<typename TResolver, typename TState>
+struct SHasGetHash<TResolver, TState, std::void_t<
+    decltype(std::declval<TResolver&>().GetHash(std::declval<TState const&>()))>> : std::true_type {};
+
+template<typename TResolver, typename TMove, typename = void>
+struct SHasGetMoveIndex : std::false_type {};
+
+template<typename TResolver, typename TMove>
+struct SHasGetMoveIndex<TResolver, TMove, std::void_t<
+    decltype(std::declval<TResolver&>().GetMoveIndex(std::declval<TMove const&>()))>> : std::true_type {};
+
+template<typename TResolver, typename TState, typename TMove, typename = void>
+struct SHasUndoMove : std::false_type {};
+
+template<typename TResolver, typename TState, typename TMove>
+struct SHasUndoMove<TResolver, TState, TMove, std::void_t<
+    decltype(std::declval<TResolver&>().UndoMove(std::declval<TState&>(), std::declval<TMove const&>()))>> : std::true_type {};
+
+template<typename TResolver, typename TState, typename TMovesContainer, typename = void>
+struct SHasGetNoisyMoves : std::false_type {};
+
+template<typename TResolver, typename TState, typename TMovesContainer>
+struct SHasGetNoisyMoves<TResolver, TState, TMovesContainer, std::void_t<
+    decltype(std::declval<TResolver&>().GetNoisyMoves(std::declval<TMovesContainer&>(), std::declval<TState const&>()))>> : std::true_type {};
+
+template<typename TResolver, typename TState, typename = void>
+struct SHasMakeNullMove : std::false_type {};
+
+template<typename TResolver, typename TState>
+struct SHasMakeNullMove<TResolver, TState, std::void_t<
+    decltype(std::declval<TResolver&>().MakeNullMove(std::declval<TState&>()))>> : std::true_type {};
+
+template<typename TResolver, typename TState, typename = void>
+struct SHasEvaluateStates : std::false_type {};
+
+template<typename TResolver, typename TState>
+struct SHasEvaluateStates<TResolver, TState, std::void_t<
+    decltype(std::declval<TResolver&>().EvaluateStates(std::declval<std::vector<TState> const&>(), std::declval<std::vector<float>&>()))>> : std::true_type {};
+
+template<typename TResolver, typename TState, typename = void>
+struct SHasGetTablebaseIndex : std::false_type {};
+
+template<typename TResolver, typename TState>
+struct SHasGetTablebaseIndex<TResolver, TState, std::void_t<
+    decltype(std::declval<TResolver&>().GetTablebaseIndex(std::declval<TState const&>(), std::declval<size_t&>()))>> : std::true_type {};
+
+template<typename TResolver, typename TState, typename TMove, typename = void>
+struct SHasSymmetries : std::false_type {};
+
+template<typename TResolver, typename TState, typename TMove>
+struct SHasSymmetries<TResolver, TState, TMove, std::void_t<
+    decltype(std::declval<TResolver&>().CanonicalizeState(std::declval<TState const&>(), std::declval<TState&>())),
+    decltype(std::declval<TResolver&>().TransformMove(std::declval<TMove const&>(), std::declval<size_t>())),
+    decltype(std::declval<TResolver&>().RestoreMove(std::declval<TMove const&>(), std::declval<size_t>()))>> : std::true_type {};
+
+template<typename TResolver, typename TState, typename TMovesContainer, typename = void>
+struct SHasGetPlayerMoves : std::false_type {};
+
+template<typename TResolver, typename TState, typename TMovesContainer>
+struct SHasGetPlayerMoves<TResolver, TState, TMovesContainer, std::void_t<
+    decltype(std::declval<TResolver&>().GetPlayerMoves(std::declval<TMovesContainer&>(), std::declval<TState const&>(), std::declval<size_t>())),
+    decltype(std::declval<TResolver&>().SetPlayerToMove(std::declval<TState&>(), std::declval<size_t>()))>> : std::true_type {};
+
+template<typename TResolver, typename = void>
+struct SAccumulatorType
+{
+    using Type = SNoAccumulator;
+};
+
+template<typename TResolver>
+struct SAccumulatorType<TResolver, std::void_t<typename TResolver::Accumulator>>
+{
+    using Type = typename TResolver::Accumulator;
+};
+
+} // details
+
+template<typename TResolver, typename TState>
+constexpr bool HasGetHash = details::SHasGetHash<TResolver, TState>::value;
+
+template<typename TResolver, typename TMove>
+constexpr bool HasGetMoveIndex = details::SHasGetMoveIndex<TResolver, TMove>::value;
+
+template<typename TResolver, typename TState, typename TMove>
+constexpr bool HasUndoMove = details::SHasUndoMove<TResolver, TState, TMove>::value;
+
+template<typename TResolver, typename TState, typename TMovesContainer>
+constexpr bool HasGetNoisyMoves = details::SHasGetNoisyMoves<TResolver, TState, TMovesContainer>::value;
+
+template<typename TResolver, typename TState>
+constexpr bool HasMakeNullMove = details::SHasMakeNullMove<TResolver, TState>::value;
+
+template<typename TResolver, typename TState>
+constexpr bool HasEvaluateStates = details::SHasEvaluateStates<TResolver, TState>::value;
+
+template<typename TResolver, typename TState>
+constexpr bool HasGetTablebaseIndex = details::SHasGetTablebaseIndex<TResolver, TState>::value;
+
+template<typename TResolver, typename TState, typename TMove>
+constexpr bool HasSymmetries = details::SHasSymmetries<TResolver, TState, TMove>::value;
+
+template<typename TResolver, typename TState, typename TMovesContainer>
+constexpr bool HasGetPlayerMoves = details::SHasGetPlayerMoves<TResolver, TState, TMovesContainer>::value;
+
+template<typename TResolver>
+using AccumulatorOf = typename details::SAccumulatorType<TResolver>::Type;
+
+template<typename TResolver>
+constexpr bool HasAccumulator = !std::is_same_v<AccumulatorOf<TResolver>, SNoAccumulator>;
+
+} // dma
+} // mimax
@@ -0,0 +1,322 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "mimax/dma/MinimaxBase.h"
+#include "mimax/mt/Task.h"
+#include "mimax/mt/TasksRunner.h"
+
+namespace mimax {
+namespace dma {
+
+/*
+Root splitting: the root moves are handed out one by one to several CMinimaxBase searchers,
+the current thread and helper tasks run by mimax::mt::CTasksRunner. The best root score found so far
+is shared through an atomic and raises the alpha of the root moves searched after it, the searchers
+also share one transposition table. Every depth of the iterative deepening is one such pass over
+the root moves, ordered by the scores of the previous depth. The helper tasks are started once
+per search and wait for the next depth between the passes.
+
+TMovesContainer and TResolver follow the CMinimaxBase contract, every searcher works with its own copy
+of the resolver. m_multiPVCount, m_useMTDf and m_aspirationWindow of the minimax config are not used.
+*/
+
+template<typename TState, typename TMove, typename TMovesContainer, typename TResolver>
+class CMinimaxRootSplitting
+{
+public:
+    using Minimax = CMinimaxBase<TState, TMove, TMovesContainer, TResolver>;
+    using State = TState;
+    using Move = TMove;
+    using SSearchResult = typename Minimax::SSearchResult;
+
+    static_assert(!HasGetHash<TResolver, TState> || IsSharedTranspositionMove<TMove>,
+        "the shared transposition table requires a plain data TMove");
+
+public:
+    struct SConfig
+    {
+        typename Minimax::SConfig m_minimaxConfig;
+        // current thread included, never more than the root moves; 0 uses all hardware threads
+        size_t m_threadsCount = 0;
+    };
+
+public:
+    CMinimaxRootSplitting(TResolver const& resolver, SConfig const& config)
+        : m_resolver(resolver)
+        , m_config(config.m_minimaxConfig)
+        , m_transpositionTable(config.m_minimaxConfig.m_transpositionTableSize)
+        , m_nextMoveIndex(0)
+        , m_alpha(0.0f)
+        , m_depth(0)
+        , m_runningHelpersCnt(0)
+        , m_isSearchFinished(false)
+        , m_isStopRequested(false)
+    {
+        size_t threadsCount = config.m_threadsCount > 0
+            ? config.m_threadsCount
+            : static_cast<size_t>(std::thread::hardware_concurrency());
+        threadsCount = threadsCount > 0 ? threadsCount : 1;
+
+        m_searchers.reserve(threadsCount);
+        for (size_t i = 0; i < threadsCount; ++i)
+        {
+            m_searchers.emplace_back(std::make_unique<Minimax>(resolver, m_config, &m_transpositionTable));
+        }
+    }
+
+    inline std::optional<TMove> FindSolution(TState const& state)
+    {
+        return Search(state).m_move;
+    }
+
+    inline SSearchResult Search(TState const& state)
+    {
+        return Search(state, SSearchLimits());
+    }
+
+    // the hard limits apply to every searcher, a depth stopped by them is dropped
+    SSearchResult Search(TState const& state, SSearchLimits const& limits)
+    {
+        SSearchResult result;
+        PrepareRootMoves(state);
+        if (m_rootMoves.empty())
+        {
+            result.m_score = m_resolver.EvaluateState(state);
+            m_isStopRequested = false;
+            return result;
+        }
+
+        if (m_config.m_keepSearchData)
+            m_transpositionTable.NextGeneration();
+        else
+            m_transpositionTable.Clear();
+        size_t const searchersCnt = std::min(m_searchers.size(), m_rootMoves.size());
+        for (size_t i = 0; i < searchersCnt; ++i)
+        {
+            m_searchers[i]->ResetStopRequest();
+            m_searchers[i]->StartRootMovesSearch(state, limits);
+        }
+        // a stop which arrived while the searchers were reset applies to them too
+        if (m_isStopRequested)
+            StopAlgorithm();
+
+        std::vector<std::unique_ptr<CRootMovesTask>> tasks;
+        std::vector<mimax::mt::ITask*> tasksPtrs;
+        for (size_t i = 1; i < searchersCnt; ++i)
+        {
+            tasks.emplace_back(std::make_unique<CRootMovesTask>(this, m_searchers[i].get(), state));
+            tasksPtrs.push_back(tasks.back().get());
+        }
+        m_depth = 0;
+        m_isSearchFinished = false;
+        mimax::mt::CTasksRunner tasksRunner;
+        tasksRunner.RunTasksAsync(tasksPtrs);
+
+        CSearchLimiter limiter;
+        limiter.Start(limits);
+        size_t const maxDepth = (limits.m_maxDepth > 0 && limits.m_maxDepth < m_config.m_maxDepth)
+            ? limits.m_maxDepth
+            : m_config.m_maxDepth;
+        size_t const firstDepth = m_config.m_useIterativeDeepening
+            ? std::min(std::max<size_t>(m_config.m_minDepth, 1), maxDepth)
+            : maxDepth;
+        for (size_t depth = std::max<size_t>(firstDepth, 1); depth <= maxDepth; ++depth)
+        {
+            SearchDepth(state, depth, searchersCnt, tasksRunner);
+            if (IsStopRequested(searchersCnt)) break;
+
+            SortRootMoves();
+            result.m_move = m_rootMoves.front().m_move;
+            result.m_score = m_rootMoves.front().m_score;
+            result.m_completedDepth = depth;
+            result.m_iterationScores.push_back(result.m_score);
+            if (limiter.IsSoftTimeExceeded()) break;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_depthMutex);
+            m_isSearchFinished = true;
+        }
+        m_depthCondition.notify_all();
+        tasksRunner.WaitForTasksCompleted();
+
+        if (result.m_move.has_value())
+            result.m_rootMoves.push_back({ result.m_move.value(), result.m_score, { result.m_move.value() } });
+        for (size_t i = 0; i < searchersCnt; ++i)
+        {
+            result.m_visitedNodesCnt += m_searchers[i]->GetVisitedNodesCount();
+        }
+        m_isStopRequested = false;
+        return result;
+    }
+
+    void StopAlgorithm()
+    {
+        m_isStopRequested = true;
+        for (auto& searcher : m_searchers)
+        {
+            searcher->StopAlgorithm();
+        }
+    }
+
+    // see CMinimaxBase::ResetStopRequest
+    inline void ResetStopRequest() { m_isStopRequested = false; }
+
+    inline size_t GetSearchersCount() const { return m_searchers.size(); }
+    inline Minimax const& GetSearcher(size_t const index) const { return *m_searchers[index]; }
+
+private:
+    struct SRootMove
+    {
+        TMove m_move;
+        float m_score = 0.0f;
+        // a move which failed low has only an upper bound of its score
+        bool m_isExact = false;
+    };
+
+    // searches the root moves of every depth the owner starts until the search is finished
+    class CRootMovesTask : public mimax::mt::ITask
+    {
+    public:
+        CRootMovesTask(CMinimaxRootSplitting* owner, Minimax* searcher, TState const& state)
+            : m_owner(owner)
+            , m_searcher(searcher)
+            , m_state(state)
+        {}
+
+        void RunTask() override
+        {
+            size_t searchedDepth = 0;
+            while (m_owner->WaitForNextDepth(searchedDepth))
+            {
+                m_owner->SearchRootMoves(*m_searcher, m_state, searchedDepth);
+                m_owner->FinishHelperDepth();
+            }
+        }
+
+        void StopTask() override
+        {
+            m_searcher->StopAlgorithm();
+        }
+
+    private:
+        CMinimaxRootSplitting* m_owner;
+        Minimax* m_searcher;
+        TState const& m_state;
+    };
+
+private:
+    void PrepareRootMoves(TState const& state)
+    {
+        TMovesContainer moves;
+        m_resolver.GetPossibleMoves(moves, state);
+        m_rootMoves.clear();
+        for (auto const& move : moves)
+        {
+            m_rootMoves.push_back({ move, 0.0f, false });
+        }
+    }
+
+    void SearchDepth(TState const& state, size_t const depth, size_t const searchersCnt, mimax::mt::CTasksRunner& tasksRunner)
+    {
+        m_nextMoveIndex = 0;
+        m_alpha = m_config.m_minValue;
+        {
+            std::lock_guard<std::mutex> lock(m_depthMutex);
+            m_depth = depth;
+            m_runningHelpersCnt = searchersCnt - 1;
+        }
+        m_depthCondition.notify_all();
+
+        SearchRootMoves(*m_searchers[0], state, depth);
+        if (IsStopRequested(searchersCnt))
+        {
+            tasksRunner.StopTasks();
+        }
+        std::unique_lock<std::mutex> lock(m_depthMutex);
+        m_depthCondition.wait(lock, [this]() { return m_runningHelpersCnt == 0; });
+    }
+
+    // returns false once the search is finished, otherwise the depth the helper has to search next
+    bool WaitForNextDepth(size_t& depthInOut)
+    {
+        std::unique_lock<std::mutex> lock(m_depthMutex);
+        m_depthCondition.wait(lock, [this, depthInOut]() { return m_isSearchFinished || m_depth != depthInOut; });
+        depthInOut = m_depth;
+        return !m_isSearchFinished;
+    }
+
+    void FinishHelperDepth()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_depthMutex);
+            --m_runningHelpersCnt;
+        }
+        m_depthCondition.notify_all();
+    }
+
+    // takes the next root move until all are searched, the first one gets the full window
+    void SearchRootMoves(Minimax& searcher, TState const& state, size_t const depth)
+    {
+        for (size_t i = m_nextMoveIndex++; i < m_rootMoves.size(); i = m_nextMoveIndex++)
+        {
+            float const alpha = m_alpha.load();
+            float const score = searcher.SearchRootMove(state, m_rootMoves[i].m_move, depth, alpha, m_config.m_maxValue, i);
+            if (searcher.IsStopRequested()) return;
+
+            m_rootMoves[i].m_score = score;
+            m_rootMoves[i].m_isExact = alpha <= m_config.m_minValue || score > alpha + m_config.m_epsilon;
+            float bestScore = m_alpha.load();
+            while (m_rootMoves[i].m_isExact && score > bestScore && !m_alpha.compare_exchange_weak(bestScore, score)) {}
+        }
+    }
+
+    // the best exact score first, the order of the previous depth breaks the ties
+    void SortRootMoves()
+    {
+        std::stable_sort(m_rootMoves.begin(), m_rootMoves.end(), [](SRootMove const& lhs, SRootMove const& rhs)
+            {
+                if (lhs.m_isExact != rhs.m_isExact)
+                    return lhs.m_isExact;
+                return lhs.m_score > rhs.m_score;
+            });
+    }
+
+    bool IsStopRequested(size_t const searchersCnt) const
+    {
+        if (m_isStopRequested)
+            return true;
+        for (size_t i = 0; i < searchersCnt; ++i)
+        {
+            if (m_searchers[i]->IsStopRequested())
+                return true;
+        }
+        return false;
+    }
+
+private:
+    TResolver m_resolver;
+    typename Minimax::SConfig m_config;
+    typename Minimax::TranspositionTable m_transpositionTable;
+    std::vector<std::unique_ptr<Minimax>> m_searchers;
+    std::vector<SRootMove> m_rootMoves;
+    std::atomic<size_t> m_nextMoveIndex;
+    std::atomic<float> m_alpha;
+    // the depth the helper tasks search, guarded by m_depthMutex as the two below
+    std::mutex m_depthMutex;
+    std::condition_variable m_depthCondition;
+    size_t m_depth;
+    size_t m_runningHelpersCnt;
+    bool m_isSearchFinished;
+    std::atomic<bool> m_isStopRequested;
+};
+
+} // dma
+} // mimax
@@ -0,0 +1,394 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "mimax/dma/MinimaxDebugInfo.h"
+
+namespace mimax {
+namespace dma {
+
+/*
+Young Brothers Wait parallel alpha-beta: the eldest child of a node is searched serially,
+then the node becomes a split point and its remaining children are shared between the current
+thread and idle helpers. The helper threads are started once by the constructor and wait for
+split points, so splitting a node costs no thread creation. The split point alpha is shared,
+a cutoff found by any thread aborts the siblings still being searched.
+
+The helpers are a private thread pool rather than mimax::mt::ITask tasks of a CTasksRunner:
+the runner starts every task with std::async and runs a fixed list of tasks to completion,
+while split points open and close at any moment of the search and an idle helper has to join
+whichever one is open. Running a task per split point would bring back a thread start per split.
+
+TMovesContainer and TResolver follow the CMinimaxBase contract, every helper thread works
+with its own copy of the resolver.
+
+TStatistics
+    SNoMinimaxParallelStatistics collects nothing, SMinimaxParallelDebugInfo counts split points
+    and the nodes and time of the search
+*/
+
+template<typename TState, typename TMove, typename TMovesContainer, typename TResolver, typename TStatistics = SNoMinimaxParallelStatistics>
+class CMinimaxYBW
+{
+public:
+    using State = TState;
+    using Move = TMove;
+
+public:
+    struct SConfig
+    {
+        float m_minValue = -1.0f;
+        float m_maxValue = 1.0f;
+        float m_epsilon = std::numeric_limits<float>::epsilon();
+        size_t m_maxDepth = 0;
+        // current thread included; 0 uses all hardware threads
+        size_t m_threadsCount = 0;
+        // nodes with a smaller remaining depth are searched serially
+        size_t m_minSplitDepth = 2;
+        // runs the same search on one thread first to report speedup and search overhead in the statistics
+        bool m_measureSerialBaseline = false;
+    };
+
+public:
+    CMinimaxYBW(TResolver const& resolver, SConfig const& config)
+        : m_resolver(resolver)
+        , m_config(config)
+        , m_idleThreadsCnt(0)
+        , m_isStopRequested(false)
+    {
+        size_t const threadsCount = m_config.m_threadsCount > 0
+            ? m_config.m_threadsCount
+            : static_cast<size_t>(std::thread::hardware_concurrency());
+        m_config.m_threadsCount = threadsCount > 0 ? threadsCount : 1;
+
+        m_helpers.reserve(m_config.m_threadsCount - 1);
+        for (size_t i = 1; i < m_config.m_threadsCount; ++i)
+        {
+            m_helpers.emplace_back([this]() { RunHelper(); });
+        }
+    }
+
+    ~CMinimaxYBW()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_poolMutex);
+            m_isShuttingDown = true;
+        }
+        m_poolCondition.notify_all();
+        for (auto& helper : m_helpers)
+        {
+            helper.join();
+        }
+    }
+
+    CMinimaxYBW(CMinimaxYBW const&) = delete;
+    CMinimaxYBW& operator=(CMinimaxYBW const&) = delete;
+
+    std::optional<TMove> FindSolution(TState const& state)
+    {
+        m_debugInfo.Reset();
+        if (m_config.m_measureSerialBaseline)
+        {
+            double searchTime = 0.0;
+            size_t const visitedNodesCnt = Search(state, 1, searchTime).m_visitedNodesCnt;
+            m_debugInfo.FinishSerialSearch(visitedNodesCnt, searchTime);
+        }
+
+        double searchTime = 0.0;
+        auto const result = Search(state, m_config.m_threadsCount, searchTime);
+        m_debugInfo.FinishSearch(result.m_visitedNodesCnt, searchTime);
+
+        auto const move = m_isStopRequested
+            ? std::optional<TMove>()
+            : result.m_move;
+        m_isStopRequested = false;
+        return move;
+    }
+
+    inline void StopAlgorithm() { m_isStopRequested = true; }
+
+    inline TStatistics const& GetDebugInfo() const { return m_debugInfo; }
+
+private:
+    struct STraversalResult
+    {
+        float m_score = 0.0f;
+        TMove m_move;
+    };
+
+    struct SSearchResult
+    {
+        TMove m_move;
+        size_t m_visitedNodesCnt = 0;
+    };
+
+    struct SWorker
+    {
+        SWorker(TResolver const& resolver) : m_resolver(resolver), m_visitedNodesCnt(0) {}
+
+        TResolver m_resolver;
+        size_t m_visitedNodesCnt;
+    };
+
+    struct SSplitPoint
+    {
+        SSplitPoint const* m_parent;
+        TState const* m_state;
+        TMovesContainer const* m_moves;
+        size_t m_ply;
+        size_t m_depth;
+        float m_beta;
+
+        std::atomic<size_t> m_nextMoveIndex;
+        std::atomic<bool> m_isAborted;
+        std::atomic<size_t> m_visitedNodesCnt;
+
+        std::mutex m_mutex;
+        float m_alpha;
+        STraversalResult m_result;
+        // helpers which joined the split point and haven't left it yet, guarded by m_mutex
+        size_t m_helpersCnt;
+        std::condition_variable m_helpersLeftCondition;
+
+        // helpers which may still join, guarded by the pool mutex
+        size_t m_freeSlotsCnt;
+
+        // a cutoff at any enclosing split point makes the whole subtree useless
+        inline bool IsAborted() const
+        {
+            for (auto splitPoint = this; splitPoint != nullptr; splitPoint = splitPoint->m_parent)
+            {
+                if (splitPoint->m_isAborted.load(std::memory_order_relaxed))
+                    return true;
+            }
+            return false;
+        }
+    };
+
+private:
+    TResolver m_resolver;
+    SConfig m_config;
+    std::atomic<size_t> m_idleThreadsCnt;
+    std::atomic<bool> m_isStopRequested;
+
+    std::vector<std::thread> m_helpers;
+    std::mutex m_poolMutex;
+    std::condition_variable m_poolCondition;
+    // split points with free slots for the idle helpers, guarded by m_poolMutex
+    std::vector<SSplitPoint*> m_openSplitPoints;
+    bool m_isShuttingDown = false;
+    TStatistics m_debugInfo;
+    std::mutex m_debugInfoMutex;
+
+private:
+    SSearchResult Search(TState const& state, size_t const threadsCount, double& searchTimeOut)
+    {
+        auto const startTime = std::chrono::high_resolution_clock::now();
+        m_idleThreadsCnt = threadsCount - 1;
+
+        SWorker worker(m_resolver);
+        auto const visitingResult = VisitState(worker, state, 0, m_config.m_maxDepth, m_config.m_minValue, m_config.m_maxValue, nullptr);
+
+        SSearchResult result;
+        result.m_move = visitingResult.m_move;
+        result.m_visitedNodesCnt = worker.m_visitedNodesCnt;
+        searchTimeOut = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+        return result;
+    }
+
+    inline bool IsAborted(SSplitPoint const* splitPoint) const
+    {
+        return m_isStopRequested || (splitPoint != nullptr && splitPoint->IsAborted());
+    }
+
+    STraversalResult VisitState(SWorker& worker, TState const& state, size_t const ply, size_t const depth, float alpha, float const beta, SSplitPoint* splitPoint)
+    {
+        ++worker.m_visitedNodesCnt;
+
+        TMovesContainer moves;
+        if (depth > 0)
+        {
+            worker.m_resolver.GetPossibleMoves(moves, state);
+        }
+        STraversalResult result;
+        if (moves.empty())
+        {
+            int const colorMultiplier = (ply & 1) == 0 ? 1 : -1;
+            result.m_score = worker.m_resolver.EvaluateState(state) * colorMultiplier;
+            return result;
+        }
+
+        result.m_score = -std::numeric_limits<float>::max();
+        for (size_t i = 0; i < moves.size(); ++i)
+        {
+            if (IsAborted(splitPoint)) return result;
+
+            // the eldest brother is always searched before the node can be split
+            if (i == 1 && depth >= m_config.m_minSplitDepth)
+            {
+                size_t const helpersCnt = ReserveHelpers(moves.size() - 2);
+                if (helpersCnt > 0)
+                {
+                    SplitNode(worker, state, moves, ply, depth, alpha, beta, splitPoint, helpersCnt, result);
+                    return result;
+                }
+            }
+
+            TState childState = state;
+            worker.m_resolver.MakeMove(childState, moves[i]);
+            auto const childResult = VisitState(worker, childState, ply + 1, depth - 1, -beta, -alpha, splitPoint);
+            if (-childResult.m_score > result.m_score)
+            {
+                result.m_move = moves[i];
+                result.m_score = -childResult.m_score;
+                alpha = (result.m_score > alpha) ? result.m_score : alpha;
+                if (alpha + m_config.m_epsilon >= beta)
+                    break;
+            }
+        }
+
+        return result;
+    }
+
+    void SplitNode(SWorker& worker, TState const& state, TMovesContainer const& moves, size_t const ply, size_t const depth,
+        float const alpha, float const beta, SSplitPoint* parentSplitPoint, size_t const helpersCnt, STraversalResult& resultOut)
+    {
+        SSplitPoint splitPoint;
+        splitPoint.m_parent = parentSplitPoint;
+        splitPoint.m_state = &state;
+        splitPoint.m_moves = &moves;
+        splitPoint.m_ply = ply;
+        splitPoint.m_depth = depth;
+        splitPoint.m_beta = beta;
+        splitPoint.m_nextMoveIndex = 1;
+        splitPoint.m_isAborted = false;
+        splitPoint.m_visitedNodesCnt = 0;
+        splitPoint.m_alpha = alpha;
+        splitPoint.m_result = resultOut;
+        splitPoint.m_helpersCnt = 0;
+        splitPoint.m_freeSlotsCnt = helpersCnt;
+
+        {
+            std::lock_guard<std::mutex> lock(m_poolMutex);
+            m_openSplitPoints.push_back(&splitPoint);
+        }
+        m_poolCondition.notify_all();
+
+        SearchSplitPoint(worker, splitPoint);
+
+        // the slots no helper has taken yet are given back, then the helpers which joined are awaited
+        {
+            std::lock_guard<std::mutex> lock(m_poolMutex);
+            if (splitPoint.m_freeSlotsCnt > 0)
+            {
+                m_openSplitPoints.erase(std::find(m_openSplitPoints.begin(), m_openSplitPoints.end(), &splitPoint));
+                m_idleThreadsCnt += splitPoint.m_freeSlotsCnt;
+                splitPoint.m_freeSlotsCnt = 0;
+            }
+        }
+        {
+            std::unique_lock<std::mutex> lock(splitPoint.m_mutex);
+            splitPoint.m_helpersLeftCondition.wait(lock, [&splitPoint]() { return splitPoint.m_helpersCnt == 0; });
+        }
+
+        worker.m_visitedNodesCnt += splitPoint.m_visitedNodesCnt;
+        resultOut = splitPoint.m_result;
+        // the split points of all the threads are counted, the lock is skipped without statistics
+        if constexpr (!std::is_same_v<TStatistics, SNoMinimaxParallelStatistics>)
+        {
+            std::lock_guard<std::mutex> lock(m_debugInfoMutex);
+            m_debugInfo.SplitNode(splitPoint.m_isAborted);
+        }
+    }
+
+    void SearchSplitPoint(SWorker& worker, SSplitPoint& splitPoint)
+    {
+        auto const& moves = *splitPoint.m_moves;
+        while (!IsAborted(&splitPoint))
+        {
+            size_t const moveIndex = splitPoint.m_nextMoveIndex++;
+            if (moveIndex >= moves.size()) return;
+
+            float alpha;
+            {
+                std::lock_guard<std::mutex> lock(splitPoint.m_mutex);
+                alpha = splitPoint.m_alpha;
+            }
+
+            auto const move = moves[moveIndex];
+            TState childState = *splitPoint.m_state;
+            worker.m_resolver.MakeMove(childState, move);
+            auto const childResult = VisitState(worker, childState, splitPoint.m_ply + 1, splitPoint.m_depth - 1, -splitPoint.m_beta, -alpha, &splitPoint);
+            if (IsAborted(&splitPoint)) return;
+
+            std::lock_guard<std::mutex> lock(splitPoint.m_mutex);
+            auto& result = splitPoint.m_result;
+            if (-childResult.m_score > result.m_score)
+            {
+                result.m_move = move;
+                result.m_score = -childResult.m_score;
+                splitPoint.m_alpha = (result.m_score > splitPoint.m_alpha) ? result.m_score : splitPoint.m_alpha;
+                if (splitPoint.m_alpha + m_config.m_epsilon >= splitPoint.m_beta)
+                {
+                    splitPoint.m_isAborted = true;
+                    return;
+                }
+            }
+        }
+    }
+
+    size_t ReserveHelpers(size_t const maxHelpersCnt)
+    {
+        size_t idleThreadsCnt = m_idleThreadsCnt.load();
+        while (idleThreadsCnt > 0)
+        {
+            size_t const helpersCnt = idleThreadsCnt < maxHelpersCnt ? idleThreadsCnt : maxHelpersCnt;
+            if (m_idleThreadsCnt.compare_exchange_weak(idleThreadsCnt, idleThreadsCnt - helpersCnt))
+                return helpersCnt;
+        }
+        return 0;
+    }
+
+    // a helper joins the split points of any thread until the searcher is destroyed
+    void RunHelper()
+    {
+        SWorker worker(m_resolver);
+        while (true)
+        {
+            SSplitPoint* splitPoint = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(m_poolMutex);
+                m_poolCondition.wait(lock, [this]() { return m_isShuttingDown || !m_openSplitPoints.empty(); });
+                if (m_isShuttingDown) return;
+
+                splitPoint = m_openSplitPoints.back();
+                if (--splitPoint->m_freeSlotsCnt == 0)
+                    m_openSplitPoints.pop_back();
+                std::lock_guard<std::mutex> splitPointLock(splitPoint->m_mutex);
+                ++splitPoint->m_helpersCnt;
+            }
+
+            worker.m_visitedNodesCnt = 0;
+            SearchSplitPoint(worker, *splitPoint);
+            splitPoint->m_visitedNodesCnt += worker.m_visitedNodesCnt;
+            ++m_idleThreadsCnt;
+
+            // the owner may destroy the split point as soon as the lock is released
+            std::lock_guard<std::mutex> lock(splitPoint->m_mutex);
+            --splitPoint->m_helpersCnt;
+            splitPoint->m_helpersLeftCondition.notify_one();
+        }
+    }
+};
+
+} // dma
+} // mimax
@@ -0,0 +1,267 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "mimax/dma/MinimaxDebugInfo.h"
+#include "mimax/dma/MinimaxResolverTraits.h"
+
+namespace mimax {
+namespace dma {
+
+enum class EMultiplayerSearch : unsigned char
+{
+    // every player maximizes its own score; shallow pruning for the games with bounded scores sum
+    MaxN,
+    // the opponents form a coalition minimizing the score of the root player, alpha-beta
+    Paranoid,
+    // the root player alternates with the single best reply of any opponent, alpha-beta;
+    // requires GetPlayerMoves and SetPlayerToMove
+    BestReply
+};
+
+/*
+Search for games of more than two players, the states are evaluated to a score of every player.
+
+TMove and TMovesContainer follow the CMinimaxBase contract.
+
+TResolver
+    size_t GetPlayerToMove(TState const&)
+        index in [0, SConfig::m_playersCount)
+    void EvaluateScores(std::vector<float>& scoresOut, TState const&)
+        scoresOut has m_playersCount elements, every score within [m_minValue, m_maxValue]
+    void GetPossibleMoves(TMovesContainer&, TState const&)
+    void MakeMove(TState&, TMove)
+
+Optional:
+    void GetPlayerMoves(TMovesContainer&, TState const&, size_t player)
+    void SetPlayerToMove(TState&, size_t player)
+        the moves of any player in the state and a turn handed to any player, used by the best-reply search;
+        MakeMove must then apply the move of the player it was generated for
+*/
+
+template<typename TState, typename TMove, typename TMovesContainer, typename TResolver, typename TStatistics = SNoMinimaxStatistics>
+class CMultiplayerMinimax
+{
+public:
+    using State = TState;
+    using Move = TMove;
+    using Scores = std::vector<float>;
+
+public:
+    struct SConfig
+    {
+        size_t m_playersCount = 3;
+        float m_minValue = 0.0f;
+        float m_maxValue = 1.0f;
+        // upper bound of the scores sum of any state, e.g. 1 for win probabilities
+        float m_maxScoresSum = 1.0f;
+        // prunes the max^n states which can't change the choice of their parent, sound only for m_maxScoresSum
+        bool m_useShallowPruning = true;
+        float m_epsilon = std::numeric_limits<float>::epsilon();
+        size_t m_maxDepth = 0;
+        EMultiplayerSearch m_search = EMultiplayerSearch::MaxN;
+    };
+
+    struct SSearchResult
+    {
+        std::optional<TMove> m_move;
+        // scores of the last state of the principal variation, the paranoid and best-reply searches
+        // optimize only the score of the root player
+        Scores m_scores;
+    };
+
+public:
+    CMultiplayerMinimax(TResolver const& resolver, SConfig const& config)
+        : m_resolver(resolver)
+        , m_config(config)
+        , m_rootPlayer(0)
+        , m_isStopRequested(false)
+    {
+        assert(m_config.m_playersCount >= 2);
+    }
+
+    inline std::optional<TMove> FindSolution(TState const& state)
+    {
+        return Search(state).m_move;
+    }
+
+    SSearchResult Search(TState const& state)
+    {
+        m_debugInfo.Reset();
+        m_rootPlayer = m_resolver.GetPlayerToMove(state);
+
+        auto const visitingResult = (m_config.m_search == EMultiplayerSearch::MaxN)
+            ? VisitMaxNState(state, 0, m_config.m_maxDepth, m_rootPlayer, -std::numeric_limits<float>::max())
+            : VisitAlphaBetaState(state, 0, m_config.m_maxDepth, m_config.m_minValue, m_config.m_maxValue);
+
+        SSearchResult result;
+        result.m_scores = visitingResult.m_scores;
+        if (visitingResult.m_hasMove)
+            result.m_move = visitingResult.m_move;
+        m_isStopRequested = false;
+        return result;
+    }
+
+    inline void StopAlgorithm() { m_isStopRequested = true; }
+
+    inline TStatistics const& GetDebugInfo() const { return m_debugInfo; }
+
+private:
+    struct STraversalResult
+    {
+        Scores m_scores;
+        bool m_hasMove = false;
+        TMove m_move;
+    };
+
+private:
+    // parentBest is the best score found so far by the player to move in the parent state
+    STraversalResult VisitMaxNState(TState const& state, size_t const ply, size_t const depth, size_t const parentPlayer, float const parentBest)
+    {
+        m_debugInfo.VisitNode(ply);
+        STraversalResult result;
+        TMovesContainer moves;
+        if (depth > 0)
+        {
+            m_resolver.GetPossibleMoves(moves, state);
+        }
+        if (moves.empty())
+        {
+            EvaluateState(state, result);
+            return result;
+        }
+
+        m_debugInfo.ExpandNode(moves.size());
+        size_t const player = m_resolver.GetPlayerToMove(state);
+        // the parent player gets at most what the others leave, once that is not more than parentBest
+        // the parent won't choose this state whatever its remaining moves are
+        bool const isPruning = m_config.m_useShallowPruning && ply > 0 && parentPlayer != player;
+        float const pruningBound = m_config.m_maxScoresSum
+            - static_cast<float>(m_config.m_playersCount - 2) * m_config.m_minValue - parentBest;
+        for (size_t i = 0; i < moves.size(); ++i)
+        {
+            if (m_isStopRequested) return result;
+
+            TState childState = state;
+            m_resolver.MakeMove(childState, moves[i]);
+            float const bestScore = result.m_hasMove ? result.m_scores[player] : -std::numeric_limits<float>::max();
+            auto childResult = VisitMaxNState(childState, ply + 1, depth - 1, player, bestScore);
+            if (!result.m_hasMove || childResult.m_scores[player] > result.m_scores[player])
+            {
+                result.m_scores.swap(childResult.m_scores);
+                result.m_move = moves[i];
+                result.m_hasMove = true;
+                if (isPruning && result.m_scores[player] + m_config.m_epsilon >= pruningBound)
+                {
+                    m_debugInfo.PruneNodes(moves.size() - (i + 1), ply + 1);
+                    m_debugInfo.CutoffMove(i);
+                    break;
+                }
+            }
+        }
+        return result;
+    }
+
+    // the root player maximizes its score, the opponents minimize it; in the best-reply search every
+    // opponent state is a single min state over the moves of all the opponents
+    STraversalResult VisitAlphaBetaState(TState const& state, size_t const ply, size_t const depth, float alpha, float beta)
+    {
+        m_debugInfo.VisitNode(ply);
+        STraversalResult result;
+        size_t const player = m_resolver.GetPlayerToMove(state);
+        bool const isMaxState = player == m_rootPlayer;
+        bool const isBestReplyState = m_config.m_search == EMultiplayerSearch::BestReply && !isMaxState;
+        size_t const firstPlayer = isBestReplyState ? 0 : player;
+        size_t const lastPlayer = isBestReplyState ? m_config.m_playersCount : player + 1;
+
+        float bestScore = isMaxState ? -std::numeric_limits<float>::max() : std::numeric_limits<float>::max();
+        size_t moveIndex = 0;
+        bool isCutoff = false;
+        for (size_t movingPlayer = firstPlayer; movingPlayer < lastPlayer && depth > 0 && !isCutoff; ++movingPlayer)
+        {
+            if (isBestReplyState && movingPlayer == m_rootPlayer)
+                continue;
+
+            TMovesContainer moves;
+            GetMoves(moves, state, movingPlayer, isBestReplyState);
+            if (!moves.empty())
+                m_debugInfo.ExpandNode(moves.size());
+            for (size_t i = 0; i < moves.size(); ++i, ++moveIndex)
+            {
+                if (m_isStopRequested) return result;
+
+                TState childState = state;
+                m_resolver.MakeMove(childState, moves[i]);
+                if (isBestReplyState)
+                    SetPlayerToMove(childState, m_rootPlayer);
+                auto childResult = VisitAlphaBetaState(childState, ply + 1, depth - 1, alpha, beta);
+                float const score = childResult.m_scores[m_rootPlayer];
+                if (!result.m_hasMove || (isMaxState ? score > bestScore : score < bestScore))
+                {
+                    bestScore = score;
+                    result.m_scores.swap(childResult.m_scores);
+                    result.m_move = moves[i];
+                    result.m_hasMove = true;
+                    if (isMaxState)
+                        alpha = (score > alpha) ? score : alpha;
+                    else
+                        beta = (score < beta) ? score : beta;
+                    if (alpha + m_config.m_epsilon >= beta)
+                    {
+                        m_debugInfo.PruneNodes(moves.size() - (i + 1), ply + 1);
+                        m_debugInfo.CutoffMove(moveIndex);
+                        isCutoff = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (!result.m_hasMove)
+            EvaluateState(state, result);
+        return result;
+    }
+
+    inline void EvaluateState(TState const& state, STraversalResult& resultOut)
+    {
+        m_debugInfo.EvaluateNode();
+        resultOut.m_scores.assign(m_config.m_playersCount, 0.0f);
+        m_resolver.EvaluateScores(resultOut.m_scores, state);
+    }
+
+    inline void GetMoves(TMovesContainer& movesOut, TState const& state, size_t const player, bool const isBestReplyState)
+    {
+        if constexpr (HasGetPlayerMoves<TResolver, TState, TMovesContainer>)
+        {
+            if (isBestReplyState)
+            {
+                m_resolver.GetPlayerMoves(movesOut, state, player);
+                return;
+            }
+        }
+        assert(!isBestReplyState && "the best-reply search requires TResolver::GetPlayerMoves and SetPlayerToMove");
+        m_resolver.GetPossibleMoves(movesOut, state);
+    }
+
+    inline void SetPlayerToMove(TState& state, size_t const player)
+    {
+        if constexpr (HasGetPlayerMoves<TResolver, TState, TMovesContainer>)
+        {
+            m_resolver.SetPlayerToMove(state, player);
+        }
+    }
+
+private:
+    TResolver m_resolver;
+    SConfig m_config;
+    size_t m_rootPlayer;
+    TStatistics m_debugInfo;
+    std::atomic<bool> m_isStopRequested;
+};
+
+} // dma
+} // mimax
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <vector>
+
+#include "mimax/common/Matrix.h"
+#include "mimax/nn/NeuralNetwork.h"
+
+namespace mimax {
+namespace dma {
+
+/*
+Evaluates states with a neural network, a batch of states is encoded into the rows of one input
+matrix and scored by a single Predict call. A minimax resolver forwards its EvaluateState and
+EvaluateStates to it to enable CMinimaxBase::SConfig::m_useBatchedEvaluation.
+
+TEncoder
+    void operator()(TState const&, mimax::common::CMatrix& inputOut, size_t rowIndex)
+        writes the network inputs of the state into the row of inputOut
+The score of a state is the first column of its output row.
+*/
+
+template<typename TState, typename TEncoder>
+class CNeuralNetworkEvaluator
+{
+public:
+    // network is not owned and must outlive the evaluator
+    CNeuralNetworkEvaluator(mimax::nn::CNeuralNetwork& network, TEncoder const& encoder, size_t const inputsCount)
+        : m_network(&network)
+        , m_encoder(encoder)
+        , m_inputsCount(inputsCount)
+    {}
+
+    float EvaluateState(TState const& state)
+    {
+        m_input.resize(1, m_inputsCount);
+        m_encoder(state, m_input, 0);
+        return m_network->Predict(m_input)(0, 0);
+    }
+
+    void EvaluateStates(std::vector<TState> const& states, std::vector<float>& scoresOut)
+    {
+        scoresOut.resize(states.size());
+        if (states.empty())
+            return;
+
+        m_input.resize(states.size(), m_inputsCount);
+        for (size_t i = 0; i < states.size(); ++i)
+        {
+            m_encoder(states[i], m_input, i);
+        }
+        auto const output = m_network->Predict(m_input);
+        for (size_t i = 0; i < states.size(); ++i)
+        {
+            scoresOut[i] = output(i, 0);
+        }
+    }
+
+private:
+    mimax::nn::CNeuralNetwork* m_network;
+    TEncoder m_encoder;
+    size_t m_inputsCount;
+    mimax::common::CMatrix m_input;
+};
+
+} // dma
+} // mimax
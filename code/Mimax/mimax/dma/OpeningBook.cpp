@@ -0,0 +1,82 @@
+#include "Mimax_PCH.h"
+#include "mimax/dma/OpeningBook.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace mimax {
+namespace dma {
+
+static inline bool IsHashLess(SOpeningBookEntry const& lhs, SOpeningBookEntry const& rhs)
+{
+    return lhs.m_hash < rhs.m_hash;
+}
+
+bool COpeningBook::Save(std::string const& path, std::vector<SOpeningBookEntry> entries)
+{
+    std::stable_sort(entries.begin(), entries.end(), IsHashLess);
+    entries.erase(std::unique(entries.begin(), entries.end(),
+        [](SOpeningBookEntry const& lhs, SOpeningBookEntry const& rhs) { return lhs.m_hash == rhs.m_hash; }),
+        entries.end());
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+        return false;
+
+    SHeader const header = { MAGIC, VERSION, entries.size() };
+    file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    file.write(reinterpret_cast<char const*>(entries.data()), entries.size() * sizeof(SOpeningBookEntry));
+    return static_cast<bool>(file);
+}
+
+bool COpeningBook::Open(std::string const& path)
+{
+    Close();
+    if (!m_file.Open(path))
+        return false;
+
+    SHeader header;
+    if (m_file.GetSize() < sizeof(header))
+    {
+        Close();
+        return false;
+    }
+    memcpy(&header, m_file.GetData(), sizeof(header));
+    if (header.m_magic != MAGIC || header.m_version != VERSION
+        || m_file.GetSize() < sizeof(header) + header.m_entriesCnt * sizeof(SOpeningBookEntry))
+    {
+        Close();
+        return false;
+    }
+
+    m_entries = reinterpret_cast<SOpeningBookEntry const*>(m_file.GetData() + sizeof(header));
+    m_entriesCnt = static_cast<size_t>(header.m_entriesCnt);
+    return true;
+}
+
+void COpeningBook::Close()
+{
+    m_file.Close();
+    m_entries = nullptr;
+    m_entriesCnt = 0;
+}
+
+bool COpeningBook::Probe(uint64_t const hash, SOpeningBookEntry& entryOut) const
+{
+    if (m_entries == nullptr)
+        return false;
+
+    SOpeningBookEntry key;
+    key.m_hash = hash;
+    SOpeningBookEntry const* end = m_entries + m_entriesCnt;
+    SOpeningBookEntry const* it = std::lower_bound(m_entries, end, key, IsHashLess);
+    if (it == end || it->m_hash != hash)
+        return false;
+
+    entryOut = *it;
+    return true;
+}
+
+} // dma
+} // mimax
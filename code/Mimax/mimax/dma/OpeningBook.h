@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mimax/common/MemoryMappedFile.h"
+
+namespace mimax {
+namespace dma {
+
+// best move of a book state, found by a deep offline search (see COpeningBookBuilder)
+struct SOpeningBookEntry
+{
+    uint64_t m_hash = 0;
+    // score of the move for the player to move
+    float m_score = 0.0f;
+    // index of the move among the moves returned by GetPossibleMoves for the state
+    uint16_t m_moveIndex = 0;
+    // depth of the search which found the move
+    uint16_t m_depth = 0;
+};
+
+static_assert(sizeof(SOpeningBookEntry) == 16, "the book file stores the entries as they are");
+
+/*
+Opening book mapping the hashes of the states (TResolver::GetHash) to their best moves.
+The file is a small header followed by the entries sorted by the hash, it is memory mapped on Open
+and probed by a binary search, so a lookup touches only a few pages of the file.
+The moves are stored as indices into GetPossibleMoves, which therefore has to list the moves
+of a state always in the same order.
+*/
+class COpeningBook
+{
+public:
+    // the entries are sorted before saving, the entries of a repeated hash but the first one are dropped
+    static bool Save(std::string const& path, std::vector<SOpeningBookEntry> entries);
+
+public:
+    bool Open(std::string const& path);
+    void Close();
+
+    inline bool IsOpen() const { return m_entries != nullptr; }
+    inline size_t GetEntriesCount() const { return m_entriesCnt; }
+
+    bool Probe(uint64_t const hash, SOpeningBookEntry& entryOut) const;
+
+private:
+    struct SHeader
+    {
+        uint32_t m_magic;
+        uint32_t m_version;
+        uint64_t m_entriesCnt;
+    };
+
+    static constexpr uint32_t MAGIC = 0x424F584D; // "MXOB"
+    static constexpr uint32_t VERSION = 1;
+
+private:
+    mimax::common::CMemoryMappedFile m_file;
+    SOpeningBookEntry const* m_entries = nullptr;
+    size_t m_entriesCnt = 0;
+};
+
+} // dma
+} // mimax
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "mimax/dma/MinimaxBase.h"
+#include "mimax/dma/OpeningBook.h"
+
+namespace mimax {
+namespace dma {
+
+/*
+Offline deep searches of all states up to m_maxPly plies after the start states; the best move of
+every searched state is stored in the opening book. The states repeated by transpositions are searched once.
+
+TResolver
+    the CMinimaxBase contract with GetHash; the factory creates the resolver evaluating the states
+    for the player to move in the given state, as the root of CMinimaxBase expects
+*/
+
+template<typename TState, typename TMove, typename TMovesContainer, typename TResolver>
+class COpeningBookBuilder
+{
+public:
+    using Minimax = CMinimaxBase<TState, TMove, TMovesContainer, TResolver>;
+    using ResolverFactory = std::function<TResolver(TState const&)>;
+
+    struct SConfig
+    {
+        typename Minimax::SConfig m_searchConfig;
+        // the states at least m_maxPly moves after a start state are not in the book
+        size_t m_maxPly = 4;
+    };
+
+public:
+    COpeningBookBuilder(ResolverFactory const& resolverFactory, SConfig const& config)
+        : m_resolverFactory(resolverFactory)
+        , m_config(config)
+    {}
+
+    std::vector<SOpeningBookEntry> Build(std::vector<TState> const& startStates)
+    {
+        std::vector<SOpeningBookEntry> entries;
+        std::unordered_set<uint64_t> searchedHashes;
+        std::vector<TState> states = startStates;
+        for (size_t ply = 0; ply < m_config.m_maxPly && !states.empty(); ++ply)
+        {
+            std::vector<TState> nextStates;
+            for (auto const& state : states)
+            {
+                TResolver resolver = m_resolverFactory(state);
+                uint64_t const hash = resolver.GetHash(state);
+                if (!searchedHashes.insert(hash).second)
+                    continue;
+
+                TMovesContainer moves;
+                resolver.GetPossibleMoves(moves, state);
+                if (moves.empty())
+                    continue;
+                assert(moves.size() <= std::numeric_limits<uint16_t>::max());
+
+                Minimax minimax(resolver, m_config.m_searchConfig);
+                auto const result = minimax.Search(state);
+                if (result.m_move.has_value())
+                    entries.push_back(CreateEntry(hash, moves, result));
+
+                if (ply + 1 == m_config.m_maxPly)
+                    continue;
+                for (auto const& move : moves)
+                {
+                    nextStates.push_back(state);
+                    resolver.MakeMove(nextStates.back(), move);
+                }
+            }
+            states.swap(nextStates);
+        }
+        return entries;
+    }
+
+    inline bool BuildAndSave(std::vector<TState> const& startStates, std::string const& path)
+    {
+        return COpeningBook::Save(path, Build(startStates));
+    }
+
+private:
+    static SOpeningBookEntry CreateEntry(uint64_t const hash, TMovesContainer& moves, typename Minimax::SSearchResult const& result)
+    {
+        SOpeningBookEntry entry;
+        entry.m_hash = hash;
+        entry.m_score = result.m_score;
+        entry.m_depth = static_cast<uint16_t>(result.m_completedDepth);
+        for (size_t i = 0; i < moves.size(); ++i)
+        {
+            if (moves[i] == result.m_move.value())
+            {
+                entry.m_moveIndex = static_cast<uint16_t>(i);
+                break;
+            }
+        }
+        return entry;
+    }
+
+private:
+    ResolverFactory m_resolverFactory;
+    SConfig m_config;
+};
+
+} // dma
+} // mimax
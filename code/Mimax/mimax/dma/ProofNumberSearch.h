@@ -0,0 +1,302 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "mimax/dma/MinimaxResolverTraits.h"
+#include "mimax/dma/SearchLimits.h"
+
+namespace mimax {
+namespace dma {
+
+enum class EProofResult : unsigned char
+{
+    // the search ran out of its budget
+    Unknown,
+    // the player to move in the root state has a forced win
+    Win,
+    // the opponent can force a draw or a win
+    NotWin
+};
+
+/*
+Depth-first proof-number search (df-pn) answering whether the player to move in the root state can force
+a win. The root player is the attacker: a state where the attacker moves is proven if any child is proven,
+a state where the defender moves if all children are. The search always expands the most-proving state
+and keeps the proof and disproof numbers in a fixed-size hash table, entries with the least work below
+them are replaced first.
+
+TMove, TMovesContainer and TResolver follow the CMinimaxBase contract, GetHash is required. With the optional
+CanonicalizeState symmetric states share their table entry.
+Terminal states are wins for the attacker when EvaluateState, from the point of view of the player
+to move in the root state, is positive. The game graph must be acyclic (no repetitions).
+*/
+
+template<typename TState, typename TMove, typename TMovesContainer, typename TResolver>
+class CProofNumberSearch
+{
+    static_assert(HasGetHash<TResolver, TState>, "the proof-number search requires TResolver::GetHash");
+
+public:
+    using State = TState;
+    using Move = TMove;
+
+public:
+    struct SConfig
+    {
+        // entries count, rounded down to a power of two
+        size_t m_tableSize = 1 << 20;
+    };
+
+    struct SSolveResult
+    {
+        EProofResult m_result = EProofResult::Unknown;
+        // a winning move of the root player
+        std::optional<TMove> m_move;
+        size_t m_visitedNodesCnt = 0;
+    };
+
+public:
+    CProofNumberSearch(TResolver const& resolver, SConfig const& config)
+        : m_resolver(resolver)
+        , m_isStopRequested(false)
+    {
+        size_t bucketsCnt = config.m_tableSize / BUCKET_SIZE;
+        while ((bucketsCnt & (bucketsCnt - 1)) != 0)
+        {
+            bucketsCnt &= bucketsCnt - 1;
+        }
+        m_entries.resize((bucketsCnt > 0 ? bucketsCnt : 1) * BUCKET_SIZE);
+    }
+
+    inline SSolveResult Solve(TState const& state)
+    {
+        return Solve(state, SSearchLimits());
+    }
+
+    // the result is unknown when a budget of limits is spent; m_maxDepth of limits is not used
+    SSolveResult Solve(TState const& state, SSearchLimits const& limits)
+    {
+        std::fill(m_entries.begin(), m_entries.end(), SEntry());
+        m_limiter.Start(limits);
+
+        SSolveResult result;
+        TState rootState = state;
+        SNumbers const numbers = VisitState(rootState, 0, INFINITE_NUMBER, INFINITE_NUMBER, &result.m_move);
+        if (numbers.m_proofNumber == 0)
+        {
+            result.m_result = EProofResult::Win;
+        }
+        else
+        {
+            result.m_move.reset();
+            if (numbers.m_disproofNumber == 0)
+                result.m_result = EProofResult::NotWin;
+        }
+        result.m_visitedNodesCnt = m_limiter.GetVisitedNodesCount();
+        m_isStopRequested = false;
+        return result;
+    }
+
+    inline void StopAlgorithm() { m_isStopRequested = true; }
+
+private:
+    static constexpr size_t BUCKET_SIZE = 4;
+    static constexpr uint32_t INFINITE_NUMBER = std::numeric_limits<uint32_t>::max();
+
+    struct SNumbers
+    {
+        uint32_t m_proofNumber = 1;
+        uint32_t m_disproofNumber = 1;
+    };
+
+    struct SEntry
+    {
+        uint64_t m_hash = 0;
+        SNumbers m_numbers;
+        // nodes visited below the state, the entries with the least work are replaced first
+        size_t m_work = 0;
+        bool m_isUsed = false;
+    };
+
+    struct SChild
+    {
+        TMove m_move;
+        TState m_state;
+        uint64_t m_hash = 0;
+        SNumbers m_numbers;
+    };
+
+private:
+    // searches the state until its proof number reaches proofThreshold or its disproof number disproofThreshold
+    SNumbers VisitState(TState const& state, size_t const ply, uint32_t const proofThreshold, uint32_t const disproofThreshold, std::optional<TMove>* bestMoveOut)
+    {
+        if (m_limiter.VisitNode())
+            m_isStopRequested = true;
+        size_t const firstVisitedNodesCnt = m_limiter.GetVisitedNodesCount();
+        uint64_t const hash = GetStateHash(state);
+        bool const isAttacker = (ply & 1) == 0;
+
+        std::vector<SChild> children;
+        {
+            TMovesContainer moves;
+            m_resolver.GetPossibleMoves(moves, state);
+            if (moves.empty())
+            {
+                bool const isWin = m_resolver.EvaluateState(state) > 0.0f;
+                SNumbers numbers;
+                numbers.m_proofNumber = isWin ? 0 : INFINITE_NUMBER;
+                numbers.m_disproofNumber = isWin ? INFINITE_NUMBER : 0;
+                Store(hash, numbers, 1);
+                return numbers;
+            }
+
+            children.resize(moves.size());
+            for (size_t i = 0; i < moves.size(); ++i)
+            {
+                children[i].m_move = moves[i];
+                children[i].m_state = state;
+                m_resolver.MakeMove(children[i].m_state, moves[i]);
+                children[i].m_hash = GetStateHash(children[i].m_state);
+            }
+        }
+
+        SNumbers numbers;
+        while (true)
+        {
+            size_t bestChild = 0;
+            uint32_t secondBestNumber = INFINITE_NUMBER;
+            numbers = CollectNumbers(children, isAttacker, bestChild, secondBestNumber);
+            if (numbers.m_proofNumber >= proofThreshold || numbers.m_disproofNumber >= disproofThreshold || m_isStopRequested)
+            {
+                if (bestMoveOut != nullptr)
+                    *bestMoveOut = children[bestChild].m_move;
+                break;
+            }
+
+            // the most-proving child is searched until it stops being the best one or its parent reaches a threshold
+            SNumbers const& childNumbers = children[bestChild].m_numbers;
+            uint32_t childProofThreshold;
+            uint32_t childDisproofThreshold;
+            if (isAttacker)
+            {
+                childProofThreshold = std::min(proofThreshold, AddNumbers(secondBestNumber, 1));
+                childDisproofThreshold = AddNumbers(disproofThreshold - numbers.m_disproofNumber, childNumbers.m_disproofNumber);
+            }
+            else
+            {
+                childProofThreshold = AddNumbers(proofThreshold - numbers.m_proofNumber, childNumbers.m_proofNumber);
+                childDisproofThreshold = std::min(disproofThreshold, AddNumbers(secondBestNumber, 1));
+            }
+            VisitState(children[bestChild].m_state, ply + 1, childProofThreshold, childDisproofThreshold, nullptr);
+        }
+
+        Store(hash, numbers, m_limiter.GetVisitedNodesCount() - firstVisitedNodesCnt + 1);
+        return numbers;
+    }
+
+    // the attacker needs one proven child and all disproven, the defender the other way round;
+    // bestChildOut is the most-proving child and secondBestNumberOut the number it has to beat
+    SNumbers CollectNumbers(std::vector<SChild>& children, bool const isAttacker, size_t& bestChildOut, uint32_t& secondBestNumberOut)
+    {
+        SNumbers numbers;
+        uint32_t minNumber = INFINITE_NUMBER;
+        uint32_t sumNumber = 0;
+        secondBestNumberOut = INFINITE_NUMBER;
+        for (size_t i = 0; i < children.size(); ++i)
+        {
+            SNumbers& childNumbers = children[i].m_numbers;
+            childNumbers = LookUp(children[i].m_hash);
+            uint32_t const minimized = isAttacker ? childNumbers.m_proofNumber : childNumbers.m_disproofNumber;
+            uint32_t const summed = isAttacker ? childNumbers.m_disproofNumber : childNumbers.m_proofNumber;
+            if (minimized < minNumber)
+            {
+                secondBestNumberOut = minNumber;
+                minNumber = minimized;
+                bestChildOut = i;
+            }
+            else if (minimized < secondBestNumberOut)
+            {
+                secondBestNumberOut = minimized;
+            }
+            sumNumber = AddNumbers(sumNumber, summed);
+        }
+
+        numbers.m_proofNumber = isAttacker ? minNumber : sumNumber;
+        numbers.m_disproofNumber = isAttacker ? sumNumber : minNumber;
+        return numbers;
+    }
+
+    inline uint64_t GetStateHash(TState const& state)
+    {
+        if constexpr (HasSymmetries<TResolver, TState, TMove>)
+        {
+            TState canonicalState;
+            m_resolver.CanonicalizeState(state, canonicalState);
+            return m_resolver.GetHash(canonicalState);
+        }
+        else
+        {
+            return m_resolver.GetHash(state);
+        }
+    }
+
+    static inline uint32_t AddNumbers(uint32_t const lhs, uint32_t const rhs)
+    {
+        return (lhs >= INFINITE_NUMBER - rhs) ? INFINITE_NUMBER : lhs + rhs;
+    }
+
+    // unknown states start with both numbers 1
+    inline SNumbers LookUp(uint64_t const hash) const
+    {
+        SEntry const* bucket = &m_entries[GetBucketIndex(hash)];
+        for (size_t i = 0; i < BUCKET_SIZE; ++i)
+        {
+            if (bucket[i].m_isUsed && bucket[i].m_hash == hash)
+                return bucket[i].m_numbers;
+        }
+        return SNumbers();
+    }
+
+    void Store(uint64_t const hash, SNumbers const& numbers, size_t const work)
+    {
+        SEntry* bucket = &m_entries[GetBucketIndex(hash)];
+        SEntry* target = nullptr;
+        for (size_t i = 0; i < BUCKET_SIZE; ++i)
+        {
+            if (!bucket[i].m_isUsed || bucket[i].m_hash == hash)
+            {
+                target = &bucket[i];
+                break;
+            }
+            if (target == nullptr || bucket[i].m_work < target->m_work)
+            {
+                target = &bucket[i];
+            }
+        }
+
+        size_t const previousWork = (target->m_isUsed && target->m_hash == hash) ? target->m_work : 0;
+        target->m_hash = hash;
+        target->m_numbers = numbers;
+        target->m_work = previousWork + work;
+        target->m_isUsed = true;
+    }
+
+    inline size_t GetBucketIndex(uint64_t const hash) const
+    {
+        return (static_cast<size_t>(hash) & (m_entries.size() / BUCKET_SIZE - 1)) * BUCKET_SIZE;
+    }
+
+private:
+    TResolver m_resolver;
+    std::vector<SEntry> m_entries;
+    CSearchLimiter m_limiter;
+    std::atomic<bool> m_isStopRequested;
+};
+
+} // dma
+} // mimax
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace mimax {
+namespace dma {
+
+// Budgets of one search, 0 disables a budget.
+struct SSearchLimits
+{
+    using Clock = std::chrono::steady_clock;
+
+    size_t m_maxNodes = 0;
+    // lowers the configured max depth
+    size_t m_maxDepth = 0;
+    // no new iterative deepening depth is started after the soft time
+    std::chrono::microseconds m_softTime{ 0 };
+    // the search is aborted after the hard time or at the deadline, whichever comes first
+    std::chrono::microseconds m_hardTime{ 0 };
+    Clock::time_point m_deadline = Clock::time_point::max();
+    // the clock is read once per this many nodes
+    size_t m_checkTimeInterval = 1024;
+};
+
+// Counts the visited nodes of a search and tells when a budget of SSearchLimits is spent.
+class CSearchLimiter
+{
+public:
+    using Clock = SSearchLimits::Clock;
+
+public:
+    void Start(SSearchLimits const& limits)
+    {
+        auto const startTime = Clock::now();
+        m_maxNodes = limits.m_maxNodes;
+        m_checkTimeInterval = limits.m_checkTimeInterval > 0 ? limits.m_checkTimeInterval : 1;
+        m_hardDeadline = limits.m_deadline;
+        if (limits.m_hardTime.count() > 0 && startTime + limits.m_hardTime < m_hardDeadline)
+            m_hardDeadline = startTime + limits.m_hardTime;
+        m_softDeadline = limits.m_softTime.count() > 0 ? startTime + limits.m_softTime : Clock::time_point::max();
+        m_softDeadline = m_softDeadline < m_hardDeadline ? m_softDeadline : m_hardDeadline;
+        m_visitedNodesCnt = 0;
+        m_nodesToTimeCheck = m_checkTimeInterval;
+    }
+
+    // returns true if the node budget is spent or the hard deadline has passed
+    inline bool VisitNode()
+    {
+        ++m_visitedNodesCnt;
+        if (m_maxNodes > 0 && m_visitedNodesCnt >= m_maxNodes)
+            return true;
+        if (--m_nodesToTimeCheck > 0)
+            return false;
+
+        m_nodesToTimeCheck = m_checkTimeInterval;
+        return m_hardDeadline != Clock::time_point::max() && Clock::now() >= m_hardDeadline;
+    }
+
+    inline bool IsSoftTimeExceeded() const
+    {
+        return m_softDeadline != Clock::time_point::max() && Clock::now() >= m_softDeadline;
+    }
+
+    inline size_t GetVisitedNodesCount() const { return m_visitedNodesCnt; }
+
+private:
+    size_t m_maxNodes = 0;
+    size_t m_checkTimeInterval = 1;
+    size_t m_nodesToTimeCheck = 1;
+    size_t m_visitedNodesCnt = 0;
+    Clock::time_point m_hardDeadline = Clock::time_point::max();
+    Clock::time_point m_softDeadline = Clock::time_point::max();
+};
+
+} // dma
+} // mimax
@@ -0,0 +1,78 @@
+#include "Mimax_PCH.h"
+#include "mimax/dma/Tablebase.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace mimax {
+namespace dma {
+
+uint16_t STablebaseEntry::Encode(STablebaseEntry const& entry)
+{
+    size_t const distance = entry.m_distance < MAX_DISTANCE ? entry.m_distance : MAX_DISTANCE;
+    return static_cast<uint16_t>((distance << 2) | static_cast<size_t>(entry.m_result));
+}
+
+STablebaseEntry STablebaseEntry::Decode(uint16_t const value)
+{
+    STablebaseEntry entry;
+    entry.m_result = static_cast<ETablebaseResult>(value & 3);
+    entry.m_distance = value >> 2;
+    return entry;
+}
+
+bool CTablebase::Save(std::string const& path, std::vector<uint16_t> const& entries)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+        return false;
+
+    SHeader const header = { MAGIC, VERSION, entries.size() };
+    file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    file.write(reinterpret_cast<char const*>(entries.data()), entries.size() * sizeof(uint16_t));
+    return static_cast<bool>(file);
+}
+
+bool CTablebase::Open(std::string const& path)
+{
+    Close();
+    if (!m_file.Open(path))
+        return false;
+
+    SHeader header;
+    if (m_file.GetSize() < sizeof(header))
+    {
+        Close();
+        return false;
+    }
+    memcpy(&header, m_file.GetData(), sizeof(header));
+    if (header.m_magic != MAGIC || header.m_version != VERSION
+        || m_file.GetSize() < sizeof(header) + header.m_entriesCnt * sizeof(uint16_t))
+    {
+        Close();
+        return false;
+    }
+
+    m_entries = reinterpret_cast<uint16_t const*>(m_file.GetData() + sizeof(header));
+    m_entriesCnt = static_cast<size_t>(header.m_entriesCnt);
+    return true;
+}
+
+void CTablebase::Close()
+{
+    m_file.Close();
+    m_entries = nullptr;
+    m_entriesCnt = 0;
+}
+
+bool CTablebase::Probe(size_t const index, STablebaseEntry& entryOut) const
+{
+    if (index >= m_entriesCnt)
+        return false;
+
+    entryOut = STablebaseEntry::Decode(m_entries[index]);
+    return entryOut.m_result != ETablebaseResult::Unknown;
+}
+
+} // dma
+} // mimax
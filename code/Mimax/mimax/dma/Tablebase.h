@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mimax/common/MemoryMappedFile.h"
+
+namespace mimax {
+namespace dma {
+
+// game theoretic value of a state for the player to move
+enum class ETablebaseResult : unsigned char
+{
+    Unknown,
+    Draw,
+    Win,
+    Loss
+};
+
+// 16-bit table entry: the result in the low 2 bits, the distance to the end of the game in plies above
+struct STablebaseEntry
+{
+    static constexpr size_t MAX_DISTANCE = (1 << 14) - 1;
+
+    ETablebaseResult m_result = ETablebaseResult::Unknown;
+    size_t m_distance = 0;
+
+    static uint16_t Encode(STablebaseEntry const& entry);
+    static STablebaseEntry Decode(uint16_t const value);
+};
+
+/*
+Win/loss/draw table of a game indexed by the resolver, built by CTablebaseBuilder.
+The file is a small header followed by one 16-bit entry per index, it is memory mapped on Open
+so only the pages of the probed states are loaded.
+*/
+class CTablebase
+{
+public:
+    static bool Save(std::string const& path, std::vector<uint16_t> const& entries);
+
+public:
+    bool Open(std::string const& path);
+    void Close();
+
+    inline bool IsOpen() const { return m_entries != nullptr; }
+    inline size_t GetEntriesCount() const { return m_entriesCnt; }
+
+    // returns false for indices out of the table and states with unknown result
+    bool Probe(size_t const index, STablebaseEntry& entryOut) const;
+
+private:
+    struct SHeader
+    {
+        uint32_t m_magic;
+        uint32_t m_version;
+        uint64_t m_entriesCnt;
+    };
+
+    static constexpr uint32_t MAGIC = 0x4254584D; // "MXTB"
+    static constexpr uint32_t VERSION = 1;
+
+private:
+    mimax::common::CMemoryMappedFile m_file;
+    uint16_t const* m_entries = nullptr;
+    size_t m_entriesCnt = 0;
+};
+
+} // dma
+} // mimax
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "mimax/dma/Tablebase.h"
+
+namespace mimax {
+namespace dma {
+
+/*
+Retrograde analysis of all states reachable from the start states. The states are enumerated
+forward with the minimax resolver contract, then the results of the terminal states are propagated
+back to their parents: a state is won if any child is lost for the opponent, lost if all children
+are won for the opponent and drawn otherwise. States left on cycles are draws.
+
+TResolver
+    the CMinimaxBase contract (GetPossibleMoves, MakeMove, EvaluateState) and
+    bool GetTablebaseIndex(TState const&, size_t& indexOut)
+        unique index lower than the entries count; every state reachable from the start states must have one
+The start states have the player evaluated by EvaluateState to move, positive evaluations are wins.
+*/
+
+template<typename TState, typename TMove, typename TMovesContainer, typename TResolver>
+class CTablebaseBuilder
+{
+public:
+    CTablebaseBuilder(TResolver const& resolver, size_t const entriesCnt)
+        : m_resolver(resolver)
+        , m_entriesCnt(entriesCnt)
+    {}
+
+    // entries of the states not reachable from startStates stay unknown
+    std::vector<uint16_t> Build(std::vector<TState> const& startStates)
+    {
+        EnumerateStates(startStates);
+        PropagateResults();
+
+        std::vector<uint16_t> entries(m_entriesCnt, STablebaseEntry::Encode(STablebaseEntry()));
+        for (auto const& node : m_nodes)
+        {
+            STablebaseEntry entry = node.m_entry;
+            if (entry.m_result == ETablebaseResult::Unknown)
+                entry.m_result = ETablebaseResult::Draw;
+            entries[node.m_index] = STablebaseEntry::Encode(entry);
+        }
+
+        m_nodes.clear();
+        m_nodeIds.clear();
+        return entries;
+    }
+
+    inline bool BuildAndSave(std::vector<TState> const& startStates, std::string const& path)
+    {
+        return CTablebase::Save(path, Build(startStates));
+    }
+
+private:
+    static constexpr size_t INVALID_NODE = std::numeric_limits<size_t>::max();
+
+    struct SNode
+    {
+        size_t m_index = 0;
+        size_t m_ply = 0;
+        // children not resolved yet, the parent is resolved as lost or drawn when it reaches 0
+        size_t m_unresolvedChildrenCnt = 0;
+        bool m_hasDrawnChild = false;
+        size_t m_maxLossDistance = 0;
+        std::vector<size_t> m_parents;
+        STablebaseEntry m_entry;
+    };
+
+private:
+    void EnumerateStates(std::vector<TState> const& startStates)
+    {
+        m_nodes.clear();
+        m_nodeIds.assign(m_entriesCnt, INVALID_NODE);
+
+        std::deque<std::pair<TState, size_t>> openStates;
+        for (auto const& state : startStates)
+        {
+            if (AddNode(state, 0) != INVALID_NODE)
+                openStates.emplace_back(state, m_nodes.size() - 1);
+        }
+
+        TMovesContainer moves;
+        while (!openStates.empty())
+        {
+            TState const state = openStates.front().first;
+            size_t const nodeId = openStates.front().second;
+            openStates.pop_front();
+
+            moves.clear();
+            m_resolver.GetPossibleMoves(moves, state);
+            if (moves.empty())
+            {
+                int const colorMultiplier = (m_nodes[nodeId].m_ply & 1) == 0 ? 1 : -1;
+                float const score = m_resolver.EvaluateState(state) * colorMultiplier;
+                m_nodes[nodeId].m_entry.m_result = score > 0.0f ? ETablebaseResult::Win
+                    : (score < 0.0f ? ETablebaseResult::Loss : ETablebaseResult::Draw);
+                m_resolvedNodes.push_back(nodeId);
+                continue;
+            }
+
+            m_nodes[nodeId].m_unresolvedChildrenCnt = moves.size();
+            for (auto const& move : moves)
+            {
+                TState childState = state;
+                m_resolver.MakeMove(childState, move);
+                size_t const nodesCnt = m_nodes.size();
+                size_t const childId = AddNode(childState, m_nodes[nodeId].m_ply + 1);
+                assert(childId != INVALID_NODE && "every reachable state must have a tablebase index");
+                assert(((m_nodes[childId].m_ply ^ m_nodes[nodeId].m_ply) & 1) == 1 && "the players must alternate");
+                m_nodes[childId].m_parents.push_back(nodeId);
+                if (childId == nodesCnt)
+                    openStates.emplace_back(childState, childId);
+            }
+        }
+    }
+
+    // returns the node of the state, a new node is added for a state seen for the first time
+    size_t AddNode(TState const& state, size_t const ply)
+    {
+        size_t index = 0;
+        if (!m_resolver.GetTablebaseIndex(state, index) || index >= m_entriesCnt)
+            return INVALID_NODE;
+
+        if (m_nodeIds[index] == INVALID_NODE)
+        {
+            m_nodeIds[index] = m_nodes.size();
+            m_nodes.emplace_back();
+            m_nodes.back().m_index = index;
+            m_nodes.back().m_ply = ply;
+        }
+        return m_nodeIds[index];
+    }
+
+    // the nodes are resolved in the order of their distances, so the first lost child gives the fastest win
+    // and the last won child the slowest loss
+    void PropagateResults()
+    {
+        for (size_t i = 0; i < m_resolvedNodes.size(); ++i)
+        {
+            SNode const& child = m_nodes[m_resolvedNodes[i]];
+            for (size_t const parentId : child.m_parents)
+            {
+                SNode& parent = m_nodes[parentId];
+                if (parent.m_entry.m_result != ETablebaseResult::Unknown)
+                    continue;
+
+                if (child.m_entry.m_result == ETablebaseResult::Loss)
+                {
+                    parent.m_entry.m_result = ETablebaseResult::Win;
+                    parent.m_entry.m_distance = child.m_entry.m_distance + 1;
+                    m_resolvedNodes.push_back(parentId);
+                    continue;
+                }
+
+                if (child.m_entry.m_result == ETablebaseResult::Draw)
+                    parent.m_hasDrawnChild = true;
+                else
+                    parent.m_maxLossDistance = child.m_entry.m_distance + 1;
+
+                if (--parent.m_unresolvedChildrenCnt == 0)
+                {
+                    parent.m_entry.m_result = parent.m_hasDrawnChild ? ETablebaseResult::Draw : ETablebaseResult::Loss;
+                    parent.m_entry.m_distance = parent.m_hasDrawnChild ? 0 : parent.m_maxLossDistance;
+                    m_resolvedNodes.push_back(parentId);
+                }
+            }
+        }
+        m_resolvedNodes.clear();
+    }
+
+private:
+    TResolver m_resolver;
+    size_t m_entriesCnt;
+    std::vector<SNode> m_nodes;
+    std::vector<size_t> m_nodeIds;
+    std::vector<size_t> m_resolvedNodes;
+};
+
+} // dma
+} // mimax
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace mimax {
+namespace dma {
+
+enum class ETranspositionBound : unsigned char
+{
+    Exact,
+    Lower,
+    Upper
+};
+
+// a move the table shared by several threads may copy while it is being overwritten: a plain
+// member-wise copy without owned resources; std::pair<int, int> qualifies even though its assignment
+// is user-provided, which makes it not trivially copyable
+template<typename TMove>
+constexpr bool IsSharedTranspositionMove = std::is_trivially_copy_constructible_v<TMove> && std::is_trivially_destructible_v<TMove>;
+
+// Fixed-size hash table of searched states. The buckets count is a power of two,
+// a stored state replaces the bucket entry of an older generation or with the shallowest search depth.
+// The table can be shared by several searching threads without locks: every bucket is guarded
+// by a sequence counter, a torn read is reported as a miss and a store into a bucket which is
+// being written by another thread is dropped. Sharing requires IsSharedTranspositionMove<TMove>.
+template<typename TMove>
+class CTranspositionTable
+{
+public:
+    static constexpr size_t BUCKET_SIZE = 4;
+
+    struct SEntry
+    {
+        uint64_t m_hash = 0;
+        float m_score = 0.0f;
+        size_t m_depth = 0;
+        ETranspositionBound m_bound = ETranspositionBound::Exact;
+        bool m_isUsed = false;
+        bool m_hasMove = false;
+        uint8_t m_generation = 0;
+        TMove m_move{};
+    };
+
+public:
+    CTranspositionTable() : m_bucketsCnt(0), m_generation(0) {}
+    CTranspositionTable(size_t const entriesCnt) : m_bucketsCnt(0), m_generation(0) { Resize(entriesCnt); }
+
+    // entriesCnt is rounded down to the power of two buckets count, 0 disables the table
+    void Resize(size_t const entriesCnt)
+    {
+        size_t bucketsCnt = entriesCnt / BUCKET_SIZE;
+        while ((bucketsCnt & (bucketsCnt - 1)) != 0)
+        {
+            bucketsCnt &= bucketsCnt - 1;
+        }
+        if (bucketsCnt == 0 && entriesCnt > 0)
+        {
+            bucketsCnt = 1;
+        }
+
+        m_buckets.reset(bucketsCnt > 0 ? new SBucket[bucketsCnt] : nullptr);
+        m_bucketsCnt = bucketsCnt;
+    }
+
+    // not thread-safe
+    inline void Clear()
+    {
+        for (size_t i = 0; i < m_bucketsCnt; ++i)
+        {
+            m_buckets[i].m_sequence.store(0, std::memory_order_relaxed);
+            for (auto& entry : m_buckets[i].m_entries)
+            {
+                entry = SEntry();
+            }
+        }
+    }
+
+    // entries stored before are kept but replaced first, for tables reused by consecutive searches; not thread-safe
+    inline void NextGeneration() { ++m_generation; }
+
+    inline bool IsEnabled() const { return m_bucketsCnt > 0; }
+    inline size_t GetEntriesCount() const { return m_bucketsCnt * BUCKET_SIZE; }
+
+    bool Probe(uint64_t const hash, SEntry& entryOut) const
+    {
+        SBucket const& bucket = GetBucket(hash);
+        uint32_t const sequence = bucket.m_sequence.load(std::memory_order_acquire);
+        if ((sequence & 1) != 0) return false;
+
+        bool isFound = false;
+        for (auto const& entry : bucket.m_entries)
+        {
+            if (entry.m_isUsed && entry.m_hash == hash)
+            {
+                entryOut = entry;
+                isFound = true;
+                break;
+            }
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return isFound && bucket.m_sequence.load(std::memory_order_relaxed) == sequence;
+    }
+
+    // returns true if an entry of another state was evicted
+    bool Store(uint64_t const hash, float const score, size_t const depth, ETranspositionBound const bound, TMove const* move)
+    {
+        SBucket& bucket = GetBucket(hash);
+        uint32_t sequence = bucket.m_sequence.load(std::memory_order_relaxed);
+        if ((sequence & 1) != 0
+            || !bucket.m_sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire))
+        {
+            return false;
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+
+        SEntry* target = nullptr;
+        for (auto& entry : bucket.m_entries)
+        {
+            if (!entry.m_isUsed || entry.m_hash == hash)
+            {
+                target = &entry;
+                break;
+            }
+            if (target == nullptr || IsReplacedBefore(entry, *target))
+            {
+                target = &entry;
+            }
+        }
+
+        bool const isCollision = target->m_isUsed && target->m_hash != hash;
+        bool const keepMove = !isCollision && target->m_isUsed && move == nullptr && target->m_hasMove;
+        target->m_hash = hash;
+        target->m_score = score;
+        target->m_depth = depth;
+        target->m_bound = bound;
+        target->m_isUsed = true;
+        target->m_generation = m_generation;
+        if (!keepMove)
+        {
+            target->m_hasMove = move != nullptr;
+            if (move != nullptr)
+                target->m_move = *move;
+        }
+
+        bucket.m_sequence.store(sequence + 2, std::memory_order_release);
+        return isCollision;
+    }
+
+private:
+    struct SBucket
+    {
+        std::atomic<uint32_t> m_sequence{ 0 };
+        SEntry m_entries[BUCKET_SIZE];
+    };
+
+private:
+    std::unique_ptr<SBucket[]> m_buckets;
+    size_t m_bucketsCnt;
+    uint8_t m_generation;
+
+private:
+    inline bool IsReplacedBefore(SEntry const& entry, SEntry const& other) const
+    {
+        bool const isOld = entry.m_generation != m_generation;
+        bool const isOtherOld = other.m_generation != m_generation;
+        return isOld != isOtherOld ? isOld : entry.m_depth < other.m_depth;
+    }
+
+    inline SBucket& GetBucket(uint64_t const hash) { return m_buckets[static_cast<size_t>(hash) & (m_bucketsCnt - 1)]; }
+    inline SBucket const& GetBucket(uint64_t const hash) const { return m_buckets[static_cast<size_t>(hash) & (m_bucketsCnt - 1)]; }
+};
+
+} // dma
+} // mimax
@@ -2,27 +2,38 @@
 
 #include <optional>
 
+#include "mimax/dma/SearchLimits.h"
 #include "mimax/mt/Task.h"
 
 namespace mimax {
 namespace dma {
 
+// TMinimax provides Search(State, SSearchLimits), StopAlgorithm and ResetStopRequest
 template<typename TMinimax>
 class CMinimaxTask : public mimax::mt::ITask
 {
 public:
     using State = typename TMinimax::State;
     using Move = typename TMinimax::Move;
+    using SearchResult = typename TMinimax::SSearchResult;
 
 public:
-    CMinimaxTask(TMinimax* minimax, State const& state)
+    CMinimaxTask(TMinimax* minimax, State const& state, SSearchLimits const& limits = SSearchLimits())
         : m_minimax(minimax)
         , m_state(state)
+        , m_limits(limits)
     {}
 
+    // a stop left from the previous run is dropped here rather than by RunTask,
+    // so StopTask arriving before RunTask reaches the search still stops it
+    void PrepareTask() override
+    {
+        m_minimax->ResetStopRequest();
+    }
+
     void RunTask() override
     {
-        m_result = m_minimax->FindSolution(m_state);
+        m_result = m_minimax->Search(m_state, m_limits);
     }
 
     void StopTask() override
@@ -30,12 +41,14 @@ public:
         m_minimax->StopAlgorithm();
     }
 
-    inline std::optional<Move> const& GetResult() const { return m_result; }
+    inline std::optional<Move> const& GetResult() const { return m_result.m_move; }
+    inline SearchResult const& GetSearchResult() const { return m_result; }
 
 private:
     State m_state;
     TMinimax* m_minimax;
-    std::optional<Move> m_result;
+    SSearchLimits m_limits;
+    SearchResult m_result;
 };
 
 } // dma
@@ -10,6 +10,8 @@ public:
 
     virtual void RunTask() = 0;
     virtual void StopTask() = 0;
+    // called on the runner's thread before RunTask is started on another one
+    virtual void PrepareTask() {}
 };
 
 } //mt
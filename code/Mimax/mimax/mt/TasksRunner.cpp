@@ -19,11 +19,20 @@ void CTasksRunner::RunTasksAndWait(vector<ITask*> const& tasks, chrono::microsec
     WaitForTasksCompleted();
 }
 
+void CTasksRunner::RunTasksAsync(vector<ITask*> const& tasks)
+{
+    m_tasks = tasks;
+    m_futures.clear();
+
+    RunTasks();
+}
+
 void CTasksRunner::RunTasks()
 {
     for (auto task : m_tasks)
     {
-        auto future = async([task]()
+        task->PrepareTask();
+        auto future = async(launch::async, [task]()
             {
                 task->RunTask();
             });
@@ -31,22 +40,27 @@ void CTasksRunner::RunTasks()
     }
 }
 
+// returns early when all the tasks have finished on their own
 void CTasksRunner::Wait(chrono::microseconds const time)
 {
-    auto const startTime = chrono::high_resolution_clock::now();
-    auto const endTime = startTime + time;
+    auto const endTime = chrono::steady_clock::now() + time;
 
-    while (chrono::high_resolution_clock::now() < endTime)
+    for (auto& future : m_futures)
     {
-        this_thread::yield();
+        if (future.wait_until(endTime) == future_status::timeout)
+            return;
     }
 }
 
+// the finished tasks are not stopped, the stop would otherwise outlive their run
 void CTasksRunner::StopTasks()
 {
-    for (auto task : m_tasks)
+    for (size_t i = 0; i < m_tasks.size(); ++i)
     {
-        task->StopTask();
+        if (i < m_futures.size() && m_futures[i].wait_for(chrono::seconds(0)) == future_status::ready)
+            continue;
+
+        m_tasks[i]->StopTask();
     }
 }
 
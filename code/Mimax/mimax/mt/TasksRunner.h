@@ -13,6 +13,12 @@ class CTasksRunner
 public:
     void RunTasksAndWait(std::vector<ITask*> const& tasks, std::chrono::microseconds const waitingTime);
 
+    // starts the tasks and returns immediately, the caller stops and waits for them
+    void RunTasksAsync(std::vector<ITask*> const& tasks);
+    // stops the tasks which are still running
+    void StopTasks();
+    void WaitForTasksCompleted();
+
 private:
     std::vector<ITask*> m_tasks;
     std::vector<std::future<void>> m_futures;
@@ -20,8 +26,6 @@ private:
 private:
     void RunTasks();
     void Wait(std::chrono::microseconds const time);
-    void StopTasks();
-    void WaitForTasksCompleted();
 };
 
 } //mt
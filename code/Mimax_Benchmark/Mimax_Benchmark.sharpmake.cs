@@ -0,0 +1,20 @@
+using Sharpmake;
+
+[Generate]
+public class MimaxBenchmarkProject : CommonProject
+{
+    public MimaxBenchmarkProject()
+    {
+        Name = "Mimax_Benchmark";
+        SourceRootPath = @"[project.SharpmakeCsPath]";
+    }
+
+    public override void ConfigureAll(Project.Configuration conf, Target target)
+    {
+        base.ConfigureAll(conf, target);
+
+        conf.IncludePaths.Add(@"[project.SourceRootPath]");
+
+        conf.AddPrivateDependency<MimaxProject>(target);
+    }
+}
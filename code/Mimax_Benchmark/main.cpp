@@ -0,0 +1,41 @@
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "mimax_benchmark/Benchmark.h"
+
+// Mimax_Benchmark [--json <path>]
+// returns 1 when a perft count does not match
+int main(int argc, char** argv)
+{
+    char const* jsonPath = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+        {
+            jsonPath = argv[++i];
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--json <path>]\n";
+            return 2;
+        }
+    }
+
+    mimax_benchmark::SBenchmarkReport report;
+    mimax_benchmark::RunTicTacToeBenchmarks(report);
+    mimax_benchmark::RunConnectFourBenchmarks(report);
+    mimax_benchmark::PrintReport(std::cout, report);
+
+    if (jsonPath != nullptr)
+    {
+        std::ofstream file(jsonPath);
+        if (!file)
+        {
+            std::cerr << "cannot write " << jsonPath << "\n";
+            return 2;
+        }
+        mimax_benchmark::WriteJson(file, report);
+    }
+    return report.IsCorrect() ? 0 : 1;
+}
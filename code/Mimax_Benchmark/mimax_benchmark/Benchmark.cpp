@@ -0,0 +1,126 @@
+#include "mimax_benchmark/Benchmark.h"
+
+#include <iomanip>
+
+namespace mimax_benchmark {
+
+    static double GetRate(double const count, double const total)
+    {
+        return total > 0.0 ? count / total : 0.0;
+    }
+
+    double SSearchBenchmarkResult::GetNodesPerSecond() const
+    {
+        return GetRate((double)m_statistics.m_totalVisitedNodesCnt, m_wallTime);
+    }
+
+    static size_t GetCutoffsCount(mimax::dma::SMinimaxDebugInfo const& statistics)
+    {
+        size_t cutoffsCnt = 0;
+        for (size_t const cnt : statistics.m_cutoffMoveIndicesCnt)
+        {
+            cutoffsCnt += cnt;
+        }
+        return cutoffsCnt;
+    }
+
+    double SSearchBenchmarkResult::GetCutoffRate() const
+    {
+        return GetRate((double)GetCutoffsCount(m_statistics), (double)m_statistics.m_expandedNodesCnt);
+    }
+
+    double SSearchBenchmarkResult::GetFirstMoveCutoffRate() const
+    {
+        return GetRate((double)m_statistics.m_cutoffMoveIndicesCnt[0], (double)GetCutoffsCount(m_statistics));
+    }
+
+    double SPerftBenchmarkResult::GetNodesPerSecond() const
+    {
+        return GetRate((double)m_visitedNodesCnt, m_wallTime);
+    }
+
+    bool SBenchmarkReport::IsCorrect() const
+    {
+        for (auto const& perft : m_perfts)
+        {
+            if (!perft.IsCorrect())
+                return false;
+        }
+        return true;
+    }
+
+    void PrintReport(std::ostream& o, SBenchmarkReport const& report)
+    {
+        o << std::fixed << std::setprecision(3);
+        for (auto const& search : report.m_searches)
+        {
+            o << search.m_game << " " << search.m_position << " " << search.m_search << " depth " << search.m_depth << "\n";
+            o << "  move " << search.m_move << ", score " << search.m_score << "\n";
+            o << "  nodes " << search.m_statistics.m_totalVisitedNodesCnt << ", time " << search.m_wallTime << "s"
+                << ", nodes/s " << (size_t)search.GetNodesPerSecond() << "\n";
+            o << "  cutoff rate " << search.GetCutoffRate() << ", first move cutoffs " << search.GetFirstMoveCutoffRate()
+                << ", branching factor " << search.m_statistics.GetBranchingFactor() << "\n";
+            o << "  nodes per depth:";
+            for (size_t depth = 0; depth <= search.m_statistics.m_maxDepth && depth <= mimax::dma::SMinimaxDebugInfo::MAX_DEPTH; ++depth)
+            {
+                o << " " << search.m_statistics.m_visitedNodesCnt[depth];
+            }
+            o << "\n";
+        }
+        for (auto const& perft : report.m_perfts)
+        {
+            o << perft.m_game << " " << perft.m_position << " perft " << perft.m_depth << ": " << perft.m_leavesCnt
+                << (perft.IsCorrect() ? "" : " MISMATCH, expected " + std::to_string(perft.m_expectedLeavesCnt))
+                << ", time " << perft.m_wallTime << "s, nodes/s " << (size_t)perft.GetNodesPerSecond() << "\n";
+        }
+        o << std::defaultfloat;
+    }
+
+    static void WriteJsonString(std::ostream& o, char const* name, std::string const& value)
+    {
+        o << "\"" << name << "\":\"" << value << "\"";
+    }
+
+    void WriteJson(std::ostream& o, SBenchmarkReport const& report)
+    {
+        o << "{\"searches\":[";
+        for (size_t i = 0; i < report.m_searches.size(); ++i)
+        {
+            auto const& search = report.m_searches[i];
+            o << (i > 0 ? "," : "") << "{";
+            WriteJsonString(o, "game", search.m_game);
+            o << ",";
+            WriteJsonString(o, "position", search.m_position);
+            o << ",";
+            WriteJsonString(o, "search", search.m_search);
+            o << ",\"depth\":" << search.m_depth << ",";
+            WriteJsonString(o, "move", search.m_move);
+            o << ",\"score\":" << search.m_score;
+            o << ",\"wallTime\":" << search.m_wallTime;
+            o << ",\"nodesPerSecond\":" << search.GetNodesPerSecond();
+            o << ",\"cutoffRate\":" << search.GetCutoffRate();
+            o << ",\"firstMoveCutoffRate\":" << search.GetFirstMoveCutoffRate();
+            o << ",\"statistics\":";
+            mimax::dma::WriteJson(o, search.m_statistics);
+            o << "}";
+        }
+        o << "],\"perfts\":[";
+        for (size_t i = 0; i < report.m_perfts.size(); ++i)
+        {
+            auto const& perft = report.m_perfts[i];
+            o << (i > 0 ? "," : "") << "{";
+            WriteJsonString(o, "game", perft.m_game);
+            o << ",";
+            WriteJsonString(o, "position", perft.m_position);
+            o << ",\"depth\":" << perft.m_depth;
+            o << ",\"leaves\":" << perft.m_leavesCnt;
+            o << ",\"expectedLeaves\":" << perft.m_expectedLeavesCnt;
+            o << ",\"isCorrect\":" << (perft.IsCorrect() ? "true" : "false");
+            o << ",\"visitedNodes\":" << perft.m_visitedNodesCnt;
+            o << ",\"wallTime\":" << perft.m_wallTime;
+            o << ",\"nodesPerSecond\":" << perft.GetNodesPerSecond();
+            o << "}";
+        }
+        o << "]}\n";
+    }
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "mimax/dma/MinimaxDebugInfo.h"
+
+namespace mimax_benchmark {
+
+    using Clock = std::chrono::steady_clock;
+
+    struct SSearchBenchmarkResult
+    {
+        std::string m_game;
+        std::string m_position;
+        std::string m_search;
+        size_t m_depth = 0;
+        std::string m_move;
+        float m_score = 0.0f;
+        double m_wallTime = 0.0;
+        mimax::dma::SMinimaxDebugInfo m_statistics;
+
+        double GetNodesPerSecond() const;
+        // share of the expanded states whose search was cut off
+        double GetCutoffRate() const;
+        // share of the cutoffs caused by the first searched move, a measure of the move ordering
+        double GetFirstMoveCutoffRate() const;
+    };
+
+    struct SPerftBenchmarkResult
+    {
+        std::string m_game;
+        std::string m_position;
+        size_t m_depth = 0;
+        size_t m_leavesCnt = 0;
+        size_t m_expectedLeavesCnt = 0;
+        size_t m_visitedNodesCnt = 0;
+        double m_wallTime = 0.0;
+
+        inline bool IsCorrect() const { return m_leavesCnt == m_expectedLeavesCnt; }
+        double GetNodesPerSecond() const;
+    };
+
+    struct SBenchmarkReport
+    {
+        std::vector<SSearchBenchmarkResult> m_searches;
+        std::vector<SPerftBenchmarkResult> m_perfts;
+
+        bool IsCorrect() const;
+    };
+
+    // one search of TMinimax, which has to collect SMinimaxDebugInfo statistics
+    template<typename TMinimax, typename TResolver, typename TToString>
+    SSearchBenchmarkResult RunSearchBenchmark(std::string const& game, std::string const& position, std::string const& search,
+        TResolver const& resolver, typename TMinimax::SConfig const& config, typename TMinimax::State const& state, TToString const& toString)
+    {
+        SSearchBenchmarkResult result;
+        result.m_game = game;
+        result.m_position = position;
+        result.m_search = search;
+        result.m_depth = config.m_maxDepth;
+
+        TMinimax minimax(resolver, config);
+        auto const startTime = Clock::now();
+        auto const searchResult = minimax.Search(state);
+        result.m_wallTime = std::chrono::duration<double>(Clock::now() - startTime).count();
+
+        result.m_move = searchResult.m_move.has_value() ? toString(searchResult.m_move.value()) : "";
+        result.m_score = searchResult.m_score;
+        result.m_statistics = minimax.GetDebugInfo();
+        return result;
+    }
+
+    // counts the states exactly depth moves after state, the finished games before depth are not counted
+    template<typename TMovesContainer, typename TResolver, typename TState>
+    size_t CountPerftLeaves(TResolver const& resolver, TState const& state, size_t const depth, size_t& visitedNodesCntOut)
+    {
+        ++visitedNodesCntOut;
+        if (depth == 0)
+            return 1;
+
+        TMovesContainer moves;
+        resolver.GetPossibleMoves(moves, state);
+        size_t leavesCnt = 0;
+        for (auto const& move : moves)
+        {
+            TState childState = state;
+            resolver.MakeMove(childState, move);
+            leavesCnt += CountPerftLeaves<TMovesContainer>(resolver, childState, depth - 1, visitedNodesCntOut);
+        }
+        return leavesCnt;
+    }
+
+    // perft checks the moves generation against the known leaves count and measures its speed
+    template<typename TMovesContainer, typename TResolver, typename TState>
+    SPerftBenchmarkResult RunPerftBenchmark(std::string const& game, std::string const& position,
+        TResolver const& resolver, TState const& state, size_t const depth, size_t const expectedLeavesCnt)
+    {
+        SPerftBenchmarkResult result;
+        result.m_game = game;
+        result.m_position = position;
+        result.m_depth = depth;
+        result.m_expectedLeavesCnt = expectedLeavesCnt;
+
+        auto const startTime = Clock::now();
+        result.m_leavesCnt = CountPerftLeaves<TMovesContainer>(resolver, state, depth, result.m_visitedNodesCnt);
+        result.m_wallTime = std::chrono::duration<double>(Clock::now() - startTime).count();
+        return result;
+    }
+
+    void PrintReport(std::ostream& o, SBenchmarkReport const& report);
+    void WriteJson(std::ostream& o, SBenchmarkReport const& report);
+
+    void RunTicTacToeBenchmarks(SBenchmarkReport& report);
+    void RunConnectFourBenchmarks(SBenchmarkReport& report);
+}
@@ -0,0 +1,58 @@
+#include "mimax_benchmark/Benchmark.h"
+
+#include "mimax/dma/MinimaxBase.h"
+
+#include "mimax_benchmark/games/ConnectFourGame.h"
+
+namespace mimax_benchmark {
+
+    using namespace games::connect_four;
+
+    using CConnectFourMinimax = mimax::dma::CMinimaxBase<SGameState, SMove, CMovesContainer, CResolver, mimax::dma::SMinimaxDebugInfo>;
+    using CConnectFourSymmetricMinimax = mimax::dma::CMinimaxBase<SGameState, SMove, CMovesContainer, CSymmetricResolver, mimax::dma::SMinimaxDebugInfo>;
+
+    template<typename TMinimax>
+    static typename TMinimax::SConfig CreateAlphaBetaConfig(size_t const depth)
+    {
+        typename TMinimax::SConfig config;
+        config.m_epsilon = 0.001f;
+        config.m_maxDepth = depth;
+        return config;
+    }
+
+    template<typename TMinimax>
+    static typename TMinimax::SConfig CreateEnhancedConfig(size_t const depth)
+    {
+        typename TMinimax::SConfig config = CreateAlphaBetaConfig<TMinimax>(depth);
+        config.m_useIterativeDeepening = true;
+        config.m_transpositionTableSize = 1 << 20;
+        config.m_useKillerMoves = true;
+        config.m_moveIndicesCount = WIDTH;
+        config.m_usePrincipalVariationSearch = true;
+        return config;
+    }
+
+    void RunConnectFourBenchmarks(SBenchmarkReport& report)
+    {
+        struct SPosition
+        {
+            char const* m_moves;
+            size_t m_depth;
+        };
+        SPosition const positions[] = { { "", 12 }, { "4453", 11 }, { "44444432", 12 } };
+        for (auto const& position : positions)
+        {
+            SGameState const state = CreateState(position.m_moves);
+            CResolver const resolver(state.m_movesCnt % 2);
+            report.m_searches.push_back(RunSearchBenchmark<CConnectFourMinimax>("ConnectFour", position.m_moves, "AlphaBeta",
+                resolver, CreateAlphaBetaConfig<CConnectFourMinimax>(position.m_depth), state, ToString));
+            report.m_searches.push_back(RunSearchBenchmark<CConnectFourMinimax>("ConnectFour", position.m_moves, "Enhanced",
+                resolver, CreateEnhancedConfig<CConnectFourMinimax>(position.m_depth), state, ToString));
+            report.m_searches.push_back(RunSearchBenchmark<CConnectFourSymmetricMinimax>("ConnectFour", position.m_moves, "EnhancedSymmetric",
+                CSymmetricResolver(state.m_movesCnt % 2), CreateEnhancedConfig<CConnectFourSymmetricMinimax>(position.m_depth), state, ToString));
+        }
+
+        report.m_perfts.push_back(RunPerftBenchmark<CMovesContainer>("ConnectFour", "", CResolver(0), CreateState(""), 7, 823536));
+        report.m_perfts.push_back(RunPerftBenchmark<CMovesContainer>("ConnectFour", "4453", CResolver(0), CreateState("4453"), 6, 108118));
+    }
+}
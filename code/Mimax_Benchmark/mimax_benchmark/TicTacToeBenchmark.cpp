@@ -0,0 +1,49 @@
+#include "mimax_benchmark/Benchmark.h"
+
+#include "mimax/dma/MinimaxBase.h"
+
+#include "mimax_benchmark/games/TicTacToeGame.h"
+
+namespace mimax_benchmark {
+
+    using namespace games::tic_tac_toe;
+
+    using CTicTacToeMinimax = mimax::dma::CMinimaxBase<SGameState, SMove, CMovesContainer, CResolver, mimax::dma::SMinimaxDebugInfo>;
+
+    static CTicTacToeMinimax::SConfig CreateAlphaBetaConfig()
+    {
+        CTicTacToeMinimax::SConfig config;
+        config.m_epsilon = 0.001f;
+        config.m_maxDepth = 9;
+        return config;
+    }
+
+    static CTicTacToeMinimax::SConfig CreateEnhancedConfig()
+    {
+        CTicTacToeMinimax::SConfig config = CreateAlphaBetaConfig();
+        config.m_useIterativeDeepening = true;
+        config.m_transpositionTableSize = 1 << 14;
+        config.m_useKillerMoves = true;
+        config.m_moveIndicesCount = 9;
+        config.m_usePrincipalVariationSearch = true;
+        return config;
+    }
+
+    void RunTicTacToeBenchmarks(SBenchmarkReport& report)
+    {
+        char const* const positions[] = { "", "5", "51" };
+        for (char const* position : positions)
+        {
+            SGameState const state = CreateState(position);
+            CResolver const resolver(state.m_movesCnt % 2);
+            report.m_searches.push_back(RunSearchBenchmark<CTicTacToeMinimax>("TicTacToe", position, "AlphaBeta",
+                resolver, CreateAlphaBetaConfig(), state, ToString));
+            report.m_searches.push_back(RunSearchBenchmark<CTicTacToeMinimax>("TicTacToe", position, "Enhanced",
+                resolver, CreateEnhancedConfig(), state, ToString));
+        }
+
+        // the games finished before the depth are not counted
+        report.m_perfts.push_back(RunPerftBenchmark<CMovesContainer>("TicTacToe", "", CResolver(0), CreateState(""), 5, 15120));
+        report.m_perfts.push_back(RunPerftBenchmark<CMovesContainer>("TicTacToe", "", CResolver(0), CreateState(""), 9, 127872));
+    }
+}
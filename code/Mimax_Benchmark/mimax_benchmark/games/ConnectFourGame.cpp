@@ -0,0 +1,157 @@
+#include "mimax_benchmark/games/ConnectFourGame.h"
+
+#include <cassert>
+
+namespace mimax_benchmark {
+namespace games {
+namespace connect_four {
+
+    static constexpr int MOVES_ORDER[WIDTH] = { 3, 2, 4, 1, 5, 0, 6 };
+
+    static inline uint64_t GetBottomMask(int const column)
+    {
+        return 1ULL << (column * (HEIGHT + 1));
+    }
+
+    static inline uint64_t GetTopMask(int const column)
+    {
+        return (1ULL << (HEIGHT - 1)) << (column * (HEIGHT + 1));
+    }
+
+    static inline uint64_t GetColumnMask(int const column)
+    {
+        return ((1ULL << HEIGHT) - 1) << (column * (HEIGHT + 1));
+    }
+
+    static bool HasAlignment(uint64_t const position)
+    {
+        // horizontal, both diagonals and vertical
+        int const shifts[4] = { HEIGHT + 1, HEIGHT, HEIGHT + 2, 1 };
+        for (int const shift : shifts)
+        {
+            uint64_t const pairs = position & (position >> shift);
+            if (pairs & (pairs >> (2 * shift)))
+                return true;
+        }
+        return false;
+    }
+
+    static inline int CountBits(uint64_t bits)
+    {
+        int count = 0;
+        for (; bits != 0; bits &= bits - 1)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    static inline bool CanPlay(SGameState const& state, int const column)
+    {
+        return (state.m_mask & GetTopMask(column)) == 0;
+    }
+
+    SGameState CreateState(std::string const& moves)
+    {
+        SGameState state;
+        for (char const move : moves)
+        {
+            int const column = move - '1';
+            assert(column >= 0 && column < WIDTH && CanPlay(state, column));
+            MakeMove(state, column);
+        }
+        return state;
+    }
+
+    void MakeMove(SGameState& state, SMove const move)
+    {
+        state.m_position ^= state.m_mask;
+        state.m_mask |= state.m_mask + GetBottomMask(move);
+        ++state.m_movesCnt;
+    }
+
+    int GetWinner(SGameState const& state)
+    {
+        if (state.m_movesCnt > 0 && HasAlignment(state.m_position ^ state.m_mask))
+            return (state.m_movesCnt - 1) & 1;
+        return state.m_movesCnt == WIDTH * HEIGHT ? 2 : -1;
+    }
+
+    void GetPossibleMoves(CMovesContainer& moves, SGameState const& state)
+    {
+        moves.clear();
+        if (GetWinner(state) != -1) return;
+
+        for (int const column : MOVES_ORDER)
+        {
+            if (CanPlay(state, column))
+                moves.push_back(column);
+        }
+    }
+
+    std::string ToString(SMove const move)
+    {
+        return std::to_string(move + 1);
+    }
+
+    float CResolver::EvaluateState(SGameState const& state) const
+    {
+        int const winner = GetWinner(state);
+        if (winner == 2) return 0.0f;
+        if (winner != -1) return winner == m_myPlayer ? 1.0f : -1.0f;
+
+        bool const isMyTurn = (state.m_movesCnt & 1) == m_myPlayer;
+        uint64_t const myStones = isMyTurn ? state.m_position : state.m_position ^ state.m_mask;
+        uint64_t const opponentStones = myStones ^ state.m_mask;
+        uint64_t const centerMask = GetColumnMask(WIDTH / 2);
+        int const centerAdvantage = CountBits(myStones & centerMask) - CountBits(opponentStones & centerMask);
+        return 0.05f * static_cast<float>(centerAdvantage);
+    }
+
+    void CResolver::GetPossibleMoves(CMovesContainer& movesOut, SGameState const& state) const
+    {
+        connect_four::GetPossibleMoves(movesOut, state);
+    }
+
+    void CResolver::MakeMove(SGameState& state, SMove const move) const
+    {
+        connect_four::MakeMove(state, move);
+    }
+
+    static uint64_t MirrorColumns(uint64_t const bits)
+    {
+        uint64_t mirrored = 0;
+        for (int column = 0; column < WIDTH; ++column)
+        {
+            uint64_t const columnBits = (bits & GetColumnMask(column)) >> (column * (HEIGHT + 1));
+            mirrored |= columnBits << ((WIDTH - 1 - column) * (HEIGHT + 1));
+        }
+        return mirrored;
+    }
+
+    size_t CSymmetricResolver::CanonicalizeState(SGameState const& state, SGameState& canonicalStateOut) const
+    {
+        canonicalStateOut = state;
+        canonicalStateOut.m_position = MirrorColumns(state.m_position);
+        canonicalStateOut.m_mask = MirrorColumns(state.m_mask);
+        // the smaller key of the two is the canonical one
+        if (state.m_position + state.m_mask <= canonicalStateOut.m_position + canonicalStateOut.m_mask)
+        {
+            canonicalStateOut = state;
+            return 0;
+        }
+        return 1;
+    }
+
+    uint64_t CResolver::GetHash(SGameState const& state) const
+    {
+        // position + mask identifies the state, the mix spreads it over the table buckets
+        uint64_t hash = state.m_position + state.m_mask;
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+}
+}
+}
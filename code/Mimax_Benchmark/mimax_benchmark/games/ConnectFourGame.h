@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace mimax_benchmark {
+namespace games {
+namespace connect_four {
+
+    constexpr int WIDTH = 7;
+    constexpr int HEIGHT = 6;
+
+    // column index
+    using SMove = int;
+    using CMovesContainer = std::vector<SMove>;
+
+    // bitboard of 7 bits per column, the top bit of every column stays empty
+    struct SGameState
+    {
+        // stones of the player to move
+        uint64_t m_position = 0;
+        // stones of both players
+        uint64_t m_mask = 0;
+        int m_movesCnt = 0;
+    };
+
+    // moves are the columns 1..7, e.g. "4453"
+    SGameState CreateState(std::string const& moves);
+    void MakeMove(SGameState& state, SMove const move);
+    // -1 no winner yet, 0 the first player, 1 the second player, 2 draw
+    int GetWinner(SGameState const& state);
+    // the central columns first
+    void GetPossibleMoves(CMovesContainer& moves, SGameState const& state);
+    std::string ToString(SMove const move);
+
+    class CResolver
+    {
+    public:
+        CResolver(int const myPlayer) : m_myPlayer(myPlayer) {}
+
+        // wins are worth 1, other states the center column advantage
+        float EvaluateState(SGameState const& state) const;
+        void GetPossibleMoves(CMovesContainer& movesOut, SGameState const& state) const;
+        void MakeMove(SGameState& state, SMove const move) const;
+        uint64_t GetHash(SGameState const& state) const;
+        size_t GetMoveIndex(SMove const move) const { return static_cast<size_t>(move); }
+
+    private:
+        int m_myPlayer;
+    };
+
+    // the board is symmetric by the mirror around the center column
+    class CSymmetricResolver : public CResolver
+    {
+    public:
+        using CResolver::CResolver;
+
+        size_t CanonicalizeState(SGameState const& state, SGameState& canonicalStateOut) const;
+        SMove TransformMove(SMove const move, size_t const symmetry) const { return symmetry == 0 ? move : WIDTH - 1 - move; }
+        SMove RestoreMove(SMove const move, size_t const symmetry) const { return TransformMove(move, symmetry); }
+    };
+}
+}
+}
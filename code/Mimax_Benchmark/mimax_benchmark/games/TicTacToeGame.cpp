@@ -0,0 +1,91 @@
+#include "mimax_benchmark/games/TicTacToeGame.h"
+
+#include <cassert>
+
+namespace mimax_benchmark {
+namespace games {
+namespace tic_tac_toe {
+
+    static constexpr uint16_t LINES[8] = { 0x007, 0x038, 0x1C0, 0x049, 0x092, 0x124, 0x111, 0x054 };
+    static constexpr uint16_t FULL_BOARD = 0x1FF;
+
+    static bool HasLine(uint16_t const cells)
+    {
+        for (uint16_t const line : LINES)
+        {
+            if ((cells & line) == line)
+                return true;
+        }
+        return false;
+    }
+
+    SGameState CreateState(std::string const& moves)
+    {
+        SGameState state;
+        for (char const move : moves)
+        {
+            int const cell = move - '1';
+            assert(cell >= 0 && cell < 9 && (((state.m_cells[0] | state.m_cells[1]) >> cell) & 1) == 0);
+            MakeMove(state, cell);
+        }
+        return state;
+    }
+
+    void MakeMove(SGameState& state, SMove const move)
+    {
+        state.m_cells[state.m_movesCnt & 1] |= static_cast<uint16_t>(1 << move);
+        ++state.m_movesCnt;
+    }
+
+    int GetWinner(SGameState const& state)
+    {
+        if (HasLine(state.m_cells[0])) return 0;
+        if (HasLine(state.m_cells[1])) return 1;
+        return (state.m_cells[0] | state.m_cells[1]) == FULL_BOARD ? 2 : -1;
+    }
+
+    void GetPossibleMoves(CMovesContainer& moves, SGameState const& state)
+    {
+        moves.clear();
+        if (GetWinner(state) != -1) return;
+
+        uint16_t const occupied = state.m_cells[0] | state.m_cells[1];
+        for (int cell = 0; cell < 9; ++cell)
+        {
+            if (((occupied >> cell) & 1) == 0)
+                moves.push_back(cell);
+        }
+    }
+
+    std::string ToString(SMove const move)
+    {
+        return std::to_string(move + 1);
+    }
+
+    float CResolver::EvaluateState(SGameState const& state) const
+    {
+        int const winner = GetWinner(state);
+        if (winner == 0 || winner == 1) return winner == m_myPlayer ? 1.0f : -1.0f;
+        return 0.0f;
+    }
+
+    void CResolver::GetPossibleMoves(CMovesContainer& movesOut, SGameState const& state) const
+    {
+        tic_tac_toe::GetPossibleMoves(movesOut, state);
+    }
+
+    void CResolver::MakeMove(SGameState& state, SMove const move) const
+    {
+        tic_tac_toe::MakeMove(state, move);
+    }
+
+    uint64_t CResolver::GetHash(SGameState const& state) const
+    {
+        uint64_t hash = state.m_cells[0] | (static_cast<uint64_t>(state.m_cells[1]) << 9);
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+}
+}
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace mimax_benchmark {
+namespace games {
+namespace tic_tac_toe {
+
+    // cell index 0..8, row by row
+    using SMove = int;
+    using CMovesContainer = std::vector<SMove>;
+
+    struct SGameState
+    {
+        // 9 bits of cells per player, the first player is X
+        uint16_t m_cells[2] = { 0, 0 };
+        int m_movesCnt = 0;
+    };
+
+    // moves are the cells 1..9, e.g. "519"
+    SGameState CreateState(std::string const& moves);
+    void MakeMove(SGameState& state, SMove const move);
+    // -1 no winner yet, 0 X, 1 O, 2 draw
+    int GetWinner(SGameState const& state);
+    void GetPossibleMoves(CMovesContainer& moves, SGameState const& state);
+    std::string ToString(SMove const move);
+
+    class CResolver
+    {
+    public:
+        CResolver(int const myPlayer) : m_myPlayer(myPlayer) {}
+
+        float EvaluateState(SGameState const& state) const;
+        void GetPossibleMoves(CMovesContainer& movesOut, SGameState const& state) const;
+        void MakeMove(SGameState& state, SMove const move) const;
+        uint64_t GetHash(SGameState const& state) const;
+        size_t GetMoveIndex(SMove const move) const { return static_cast<size_t>(move); }
+
+    private:
+        int m_myPlayer;
+    };
+}
+}
+}
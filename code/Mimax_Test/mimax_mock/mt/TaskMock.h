@@ -14,6 +14,7 @@ public:
 
     MOCK_METHOD(void, RunTask, (), (override));
     MOCK_METHOD(void, StopTask, (), (override));
+    MOCK_METHOD(void, PrepareTask, (), (override));
 };
 
 using CTaskNiceMock = testing::NiceMock<CTaskMock>;
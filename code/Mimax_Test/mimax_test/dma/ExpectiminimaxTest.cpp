@@ -0,0 +1,275 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "mimax/dma/Expectiminimax.h"
+
+namespace mimax_test {
+namespace dma {
+namespace expectiminimax {
+
+using namespace mimax::dma;
+using namespace std;
+
+enum class ENodeType
+{
+    Max,
+    Min,
+    Chance,
+    Leaf
+};
+
+struct SNode
+{
+    ENodeType m_type = ENodeType::Leaf;
+    vector<size_t> m_children;
+    vector<float> m_probabilities;
+    float m_value = 0.0f;
+};
+
+using CTree = vector<SNode>;
+
+// the moves and the outcomes are the indices of the child nodes
+using CMovesContainer = vector<size_t>;
+
+class CTreeResolver
+{
+public:
+    CTreeResolver(shared_ptr<CTree const> tree) : m_tree(move(tree)) {}
+
+    void GetPossibleMoves(CMovesContainer& movesOut, size_t const& state) const
+    {
+        movesOut = (*m_tree)[state].m_children;
+    }
+
+    void MakeMove(size_t& state, size_t const& move) const
+    {
+        state = move;
+    }
+
+    float EvaluateState(size_t const& state) const
+    {
+        return (*m_tree)[state].m_value;
+    }
+
+    bool IsChanceState(size_t const& state) const
+    {
+        return (*m_tree)[state].m_type == ENodeType::Chance;
+    }
+
+    void GetChanceOutcomes(vector<SChanceOutcome<size_t>>& outcomesOut, size_t const& state) const
+    {
+        SNode const& node = (*m_tree)[state];
+        for (size_t i = 0; i < node.m_children.size(); ++i)
+        {
+            outcomesOut.push_back({ node.m_children[i], node.m_probabilities[i] });
+        }
+    }
+
+private:
+    shared_ptr<CTree const> m_tree;
+};
+
+using CTreeExpectiminimax = CExpectiminimax<size_t, size_t, CMovesContainer, CTreeResolver, SMinimaxDebugInfo>;
+
+class CStoppingTreeResolver : public CTreeResolver
+{
+public:
+    CStoppingTreeResolver(shared_ptr<CTree const> tree, function<void()>* stopFunc, size_t const evaluationsBeforeStop)
+        : CTreeResolver(move(tree))
+        , m_stopFunc(stopFunc)
+        , m_evaluationsBeforeStop(evaluationsBeforeStop)
+    {}
+
+    float EvaluateState(size_t const& state) const
+    {
+        if (m_evaluationsBeforeStop > 0 && --m_evaluationsBeforeStop == 0)
+            (*m_stopFunc)();
+        return CTreeResolver::EvaluateState(state);
+    }
+
+private:
+    function<void()>* m_stopFunc;
+    mutable size_t m_evaluationsBeforeStop;
+};
+
+// levels go Max, Chance, Min, Chance, ... and end with leaves valued in [-1, 1]
+static size_t AddNode(CTree& tree, size_t const level, size_t const levelsCnt, size_t const branchingFactor, mt19937& generator)
+{
+    size_t const nodeId = tree.size();
+    tree.emplace_back();
+    if (level == levelsCnt)
+    {
+        tree[nodeId].m_value = uniform_real_distribution<float>(-1.0f, 1.0f)(generator);
+        return nodeId;
+    }
+
+    ENodeType const type = (level % 2 == 1) ? ENodeType::Chance : (level % 4 == 0 ? ENodeType::Max : ENodeType::Min);
+    tree[nodeId].m_type = type;
+    float probabilitiesSum = 0.0f;
+    for (size_t i = 0; i < branchingFactor; ++i)
+    {
+        size_t const childId = AddNode(tree, level + 1, levelsCnt, branchingFactor, generator);
+        tree[nodeId].m_children.push_back(childId);
+        float const weight = uniform_real_distribution<float>(0.1f, 1.0f)(generator);
+        tree[nodeId].m_probabilities.push_back(weight);
+        probabilitiesSum += weight;
+    }
+    for (auto& probability : tree[nodeId].m_probabilities)
+    {
+        probability /= probabilitiesSum;
+    }
+    return nodeId;
+}
+
+static shared_ptr<CTree const> CreateTree(size_t const levelsCnt, size_t const branchingFactor, unsigned const seed)
+{
+    mt19937 generator(seed);
+    auto tree = make_shared<CTree>();
+    AddNode(*tree, 0, levelsCnt, branchingFactor, generator);
+    return tree;
+}
+
+static float Expectimax(CTree const& tree, size_t const nodeId);
+
+// puts the best move first in every player node, as a good move ordering would
+static void OrderMoves(CTree& tree)
+{
+    for (auto& node : tree)
+    {
+        if (node.m_type != ENodeType::Max && node.m_type != ENodeType::Min)
+            continue;
+
+        bool const isMax = node.m_type == ENodeType::Max;
+        sort(node.m_children.begin(), node.m_children.end(), [&tree, isMax](size_t const lhs, size_t const rhs) {
+            return isMax ? Expectimax(tree, lhs) > Expectimax(tree, rhs) : Expectimax(tree, lhs) < Expectimax(tree, rhs);
+        });
+    }
+}
+
+static float Expectimax(CTree const& tree, size_t const nodeId)
+{
+    SNode const& node = tree[nodeId];
+    if (node.m_type == ENodeType::Leaf)
+        return node.m_value;
+
+    float result = (node.m_type == ENodeType::Max) ? -2.0f : (node.m_type == ENodeType::Min ? 2.0f : 0.0f);
+    for (size_t i = 0; i < node.m_children.size(); ++i)
+    {
+        float const value = Expectimax(tree, node.m_children[i]);
+        switch (node.m_type)
+        {
+        case ENodeType::Max: result = max(result, value); break;
+        case ENodeType::Min: result = min(result, value); break;
+        default: result += node.m_probabilities[i] * value; break;
+        }
+    }
+    return result;
+}
+
+static CTreeExpectiminimax::SConfig CreateConfig(EChancePruning const chancePruning)
+{
+    CTreeExpectiminimax::SConfig config;
+    config.m_epsilon = 1e-6f;
+    config.m_maxDepth = 100;
+    config.m_chancePruning = chancePruning;
+    return config;
+}
+
+static void Search_RandomTrees_ReturnsExpectimaxScore(EChancePruning const chancePruning)
+{
+    for (unsigned seed = 1; seed <= 10; ++seed)
+    {
+        auto const tree = CreateTree(8, 3, seed);
+        CTreeExpectiminimax expectiminimax(CTreeResolver(tree), CreateConfig(chancePruning));
+
+        auto const result = expectiminimax.Search(0);
+
+        ASSERT_TRUE(result.m_move.has_value());
+        EXPECT_NEAR(result.m_score, Expectimax(*tree, 0), 1e-4f) << "seed " << seed;
+        EXPECT_NEAR(Expectimax(*tree, result.m_move.value()), Expectimax(*tree, 0), 1e-4f) << "seed " << seed;
+    }
+}
+
+GTEST_TEST(DmaCExpectiminimax, SearchWithoutPruningReturnsExpectimaxScore)
+{
+    Search_RandomTrees_ReturnsExpectimaxScore(EChancePruning::None);
+}
+
+GTEST_TEST(DmaCExpectiminimax, SearchWithStar1ReturnsExpectimaxScore)
+{
+    Search_RandomTrees_ReturnsExpectimaxScore(EChancePruning::Star1);
+}
+
+GTEST_TEST(DmaCExpectiminimax, SearchWithStar2ReturnsExpectimaxScore)
+{
+    Search_RandomTrees_ReturnsExpectimaxScore(EChancePruning::Star2);
+}
+
+GTEST_TEST(DmaCExpectiminimax, SearchLimitedDepthEvaluatesFrontier)
+{
+    // a Max, Chance, Min, Chance, leaves tree searched one player move deep evaluates the Min nodes
+    auto tree = make_shared<CTree>(*CreateTree(4, 2, 7));
+    for (auto& node : *tree)
+    {
+        if (node.m_type == ENodeType::Min)
+            node.m_value = 0.5f;
+    }
+    CTreeExpectiminimax::SConfig config = CreateConfig(EChancePruning::Star2);
+    config.m_maxDepth = 1;
+    CTreeExpectiminimax expectiminimax(CTreeResolver(tree), config);
+
+    auto const result = expectiminimax.Search(0);
+
+    EXPECT_NEAR(result.m_score, 0.5f, 1e-4f);
+}
+
+GTEST_TEST(DmaCExpectiminimax, SearchStoppedReturnsNoMove)
+{
+    using CStoppingExpectiminimax = CExpectiminimax<size_t, size_t, CMovesContainer, CStoppingTreeResolver>;
+    auto const tree = CreateTree(8, 3, 1);
+    CStoppingExpectiminimax::SConfig config;
+    config.m_maxDepth = 100;
+    function<void()> stopFunc;
+    CStoppingExpectiminimax expectiminimax(CStoppingTreeResolver(tree, &stopFunc, 5), config);
+    stopFunc = [&expectiminimax]() { expectiminimax.StopAlgorithm(); };
+
+    auto const stoppedResult = expectiminimax.Search(0);
+    auto const result = expectiminimax.Search(0);
+
+    EXPECT_FALSE(stoppedResult.m_move.has_value());
+    EXPECT_TRUE(result.m_move.has_value());
+}
+
+// Star2 pays off only when the first probed move is a good one
+GTEST_TEST(DmaCExpectiminimax, SearchWithStarPruningVisitsFewerNodes)
+{
+    size_t visitedNodesCnt[3] = {};
+    size_t chanceCutoffsCnt[3] = {};
+    EChancePruning const chancePrunings[3] = { EChancePruning::None, EChancePruning::Star1, EChancePruning::Star2 };
+    for (unsigned seed = 1; seed <= 10; ++seed)
+    {
+        auto tree = make_shared<CTree>(*CreateTree(8, 3, seed));
+        OrderMoves(*tree);
+        for (size_t i = 0; i < 3; ++i)
+        {
+            CTreeExpectiminimax expectiminimax(CTreeResolver(tree), CreateConfig(chancePrunings[i]));
+            expectiminimax.Search(0);
+            visitedNodesCnt[i] += expectiminimax.GetDebugInfo().m_totalVisitedNodesCnt;
+            chanceCutoffsCnt[i] += expectiminimax.GetDebugInfo().m_chanceCutoffsCnt;
+        }
+    }
+
+    EXPECT_EQ(chanceCutoffsCnt[0], 0u);
+    EXPECT_GT(chanceCutoffsCnt[1], 0u);
+    EXPECT_LT(visitedNodesCnt[1], visitedNodesCnt[0]);
+    EXPECT_LT(visitedNodesCnt[2], visitedNodesCnt[1]);
+}
+
+} // expectiminimax
+} // dma
+} // mimax_test
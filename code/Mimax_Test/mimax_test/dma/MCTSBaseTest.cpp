@@ -1,3 +1,6 @@
+#include <cstdint>
+#include <filesystem>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -5,6 +8,7 @@
 #include "gmock/gmock.h"
 
 #include "mimax/dma/MCTSBase.h"
+#include "mimax/dma/OpeningBook.h"
 
 namespace mimax_test {
 namespace dma {
@@ -70,7 +74,17 @@ public:
     }
 };
 
+class CHashingTestResolver : public CTestResolver
+{
+public:
+    uint64_t GetHash(STestState const* state)
+    {
+        return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(state));
+    }
+};
+
 using CTestMCTS = CMCTSBase<STestState*, STestMove, CTestMovesContainer, CTestResolver>;
+using CHashingTestMCTS = CMCTSBase<STestState*, STestMove, CTestMovesContainer, CHashingTestResolver>;
 
 static CTestMCTS CreateTestMCTS(STestState* state)
 {
@@ -79,7 +93,8 @@ static CTestMCTS CreateTestMCTS(STestState* state)
     return CTestMCTS(state, CTestResolver(), randomSeed, explorationParam);
 }
 
-static void EvaluateNTimes(CTestMCTS& mcts, size_t const iterationsCnt)
+template<typename TMCTS>
+static void EvaluateNTimes(TMCTS& mcts, size_t const iterationsCnt)
 {
     for (size_t i = 0; i < iterationsCnt; ++i)
     {
@@ -137,6 +152,25 @@ GTEST_TEST(DmaCMCTSBase, GetCurrentResultEvaluateTwoLevelsTree100TimesReturnsBes
     EXPECT_EQ(bestMove, 0);
 }
 
+GTEST_TEST(DmaCMCTSBase, GetCurrentResultWithOpeningBookReturnsBookMoveWithoutVisits)
+{
+    STestState rootState = CreateTestStateWithSubstates(3, 2);
+    mimax::dma::SOpeningBookEntry entry;
+    entry.m_hash = CHashingTestResolver().GetHash(&rootState);
+    entry.m_moveIndex = 4;
+    std::string const path = (std::filesystem::temp_directory_path() / "mimax_mcts.mxob").string();
+    ASSERT_TRUE(mimax::dma::COpeningBook::Save(path, { entry }));
+    mimax::dma::COpeningBook openingBook;
+    ASSERT_TRUE(openingBook.Open(path));
+    CHashingTestMCTS mcts(&rootState, CHashingTestResolver(), 1234567890ULL);
+    mcts.SetOpeningBook(&openingBook);
+
+    EvaluateNTimes(mcts, 10);
+
+    EXPECT_EQ(mcts.GetCurrentResult(), 4);
+    EXPECT_THAT(rootState.m_children, testing::Each(TestStateIsVisitedMatcher(false)));
+}
+
 } // mcts
 } // dma
 } // mimax_test
\ No newline at end of file
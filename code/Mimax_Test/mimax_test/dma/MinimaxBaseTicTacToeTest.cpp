@@ -1,78 +1,49 @@
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
 #include "mimax/dma/MinimaxBase.h"
+#include "mimax/dma/tasks/MinimaxTask.h"
+#include "mimax/mt/TasksRunner.h"
 
+#include "mimax_test/dma/MinimaxTicTacToeResolvers.h"
 #include "mimax_test/games/TicTacToeGame.h"
 
 namespace mimax_test {
 namespace dma {
 namespace minimax {
 
-    using STicTacToeMove = mimax_test::games::tic_tac_toe::SMove;
-    using STicTacToeState = mimax_test::games::tic_tac_toe::SGameState;
-    using CTicTacToeMovesContainer = std::vector<STicTacToeMove>;
-    using FindNextMoveFunc = mimax_test::games::tic_tac_toe::FindNextMoveFunc;
+    using mimax::dma::SMinimaxDebugInfo;
 
-    class CMinimaxResolver
-    {
-    public:
-        CMinimaxResolver(char const myPlayer)
-            : m_myPlayer(myPlayer)
-        {}
-
-        CMinimaxResolver(char const myPlayer, std::vector<STicTacToeState> const& unexpectedStates)
-            : m_myPlayer(myPlayer)
-            , m_unexpectedStates(unexpectedStates)
-        {}
-
-        float EvaluateState(STicTacToeState const& state)
-        {
-            CheckUnexpectedStates(state);
-            char const winner = mimax_test::games::tic_tac_toe::GetWinner(state);
-            if (winner == '-' || winner == 'D') return 0.0f;
-            return winner == m_myPlayer ? 1.0f : -1.0f;
-        }
-
-        void GetPossibleMoves(CTicTacToeMovesContainer& movesOut, STicTacToeState const& state)
-        {
-            CheckUnexpectedStates(state);
-            mimax_test::games::tic_tac_toe::GetPossibleMoves(movesOut, state);
-        }
-
-        void MakeMove(STicTacToeState& state, STicTacToeMove const move)
-        {
-            CheckUnexpectedStates(state);
-            mimax_test::games::tic_tac_toe::MakeMove(state, move);
-        }
+    using CTicTacToeMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CMinimaxResolver, SMinimaxDebugInfo>;
+    using CTicTacToeHashingMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CHashingMinimaxResolver, SMinimaxDebugInfo>;
+    using CTicTacToeSymmetricMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CSymmetricMinimaxResolver, SMinimaxDebugInfo>;
+    using CTicTacToeMoveIndexingMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CMoveIndexingMinimaxResolver, SMinimaxDebugInfo>;
+    using CTicTacToeUndoingMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CUndoingMinimaxResolver, SMinimaxDebugInfo>;
+    using CTicTacToeQuiescenceMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CQuiescenceMinimaxResolver, SMinimaxDebugInfo>;
+    using CTicTacToeNullMoveMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CNullMoveMinimaxResolver, SMinimaxDebugInfo>;
+    using CTicTacToeAccumulatingMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CAccumulatingMinimaxResolver, SMinimaxDebugInfo>;
+    using CTicTacToeBatchingMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CBatchingMinimaxResolver, SMinimaxDebugInfo>;
+    using CTicTacToeBatchingHashingMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CBatchingHashingMinimaxResolver, SMinimaxDebugInfo>;
 
-    private:
-        std::vector<STicTacToeState> m_unexpectedStates;
-        char m_myPlayer;
-
-    private:
-        void CheckUnexpectedStates(STicTacToeState const& state)
-        {
-            EXPECT_THAT(m_unexpectedStates, testing::Not(testing::Contains(state)));
-        }
-    };
-
-    using CTicTacToeMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CMinimaxResolver>;
-
-    static FindNextMoveFunc CreateFindNextMoveFunc(std::vector<STicTacToeState> const& unexpectedStates = std::vector<STicTacToeState>())
+    template<typename TMinimax = CTicTacToeMinimax, typename TResolver = CMinimaxResolver>
+    static FindNextMoveFunc CreateFindNextMoveFunc(
+        typename TMinimax::SConfig const& config = CreateConfig<TMinimax>(),
+        std::vector<STicTacToeState> const& unexpectedStates = std::vector<STicTacToeState>())
     {
-        return [&unexpectedStates](STicTacToeState const& state) {
-            CTicTacToeMinimax::SConfig config;
-            config.m_maxValue = 1.0f;
-            config.m_minValue = -1.0f;
-            config.m_maxDepth = 9;
-            config.m_epsilon = 0.1f;
-            CMinimaxResolver const resolver(state.m_player, unexpectedStates);
+        return [config, unexpectedStates](STicTacToeState const& state) {
+            TResolver const resolver(state.m_player, unexpectedStates);
 
-            CTicTacToeMinimax minimax(resolver, config);
+            TMinimax minimax(resolver, config);
             return minimax.FindSolution(state).value();
         };
     }
@@ -95,9 +66,11 @@ namespace minimax {
         EXPECT_THAT(unexpectedMoves, testing::Not(testing::Contains(move)));
     }
 
-    static void PlayGame_SpecifiedState_ReturnsExpectedWinner(STicTacToeState const& state, char const expectedWinner)
+    template<typename TMinimax = CTicTacToeMinimax, typename TResolver = CMinimaxResolver>
+    static void PlayGame_SpecifiedState_ReturnsExpectedWinner(STicTacToeState const& state, char const expectedWinner,
+        typename TMinimax::SConfig const& config = CreateConfig<TMinimax>())
     {
-        auto findNextMoveFunc = CreateFindNextMoveFunc();
+        auto findNextMoveFunc = CreateFindNextMoveFunc<TMinimax, TResolver>(config);
 
         auto const winner = mimax_test::games::tic_tac_toe::PlayGame(state, findNextMoveFunc);
 
@@ -106,7 +79,7 @@ namespace minimax {
 
     static void PlayGame_SpecifiedState_NotEntersUnexpectedStates(STicTacToeState const& state, std::vector<STicTacToeState> const& unexpectedStates)
     {
-        auto findNextMoveFunc = CreateFindNextMoveFunc(unexpectedStates);
+        auto findNextMoveFunc = CreateFindNextMoveFunc(CreateConfig<CTicTacToeMinimax>(), unexpectedStates);
 
         mimax_test::games::tic_tac_toe::PlayGame(state, findNextMoveFunc);
     }
@@ -230,6 +203,956 @@ namespace minimax {
         );
     }
     
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithTranspositionTableSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeHashingMinimax, CHashingMinimaxResolver>(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            },
+            'D'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithTranspositionTableSpecifiedStateReturnsWinnerX)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeHashingMinimax, CHashingMinimaxResolver>(
+            {
+                {"X--",
+                 "-O-",
+                 "O-X"}, 'X'
+            },
+            'X'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, FindSolutionWithTranspositionTableVisitsFewerNodes)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateConfig<CTicTacToeMinimax>());
+        CTicTacToeHashingMinimax hashingMinimax(CHashingMinimaxResolver(state.m_player), CreateConfig<CTicTacToeHashingMinimax>());
+
+        minimax.FindSolution(state);
+        hashingMinimax.FindSolution(state);
+
+        EXPECT_GT(hashingMinimax.GetDebugInfo().m_transpositionHitsCnt, 0u);
+        EXPECT_LT(hashingMinimax.GetDebugInfo().m_totalVisitedNodesCnt, minimax.GetDebugInfo().m_totalVisitedNodesCnt);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithSymmetriesSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeSymmetricMinimax, CSymmetricMinimaxResolver>(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            },
+            'D'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithSymmetriesSpecifiedStateReturnsWinnerX)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeSymmetricMinimax, CSymmetricMinimaxResolver>(
+            {
+                {"X--",
+                 "-O-",
+                 "O-X"}, 'X'
+            },
+            'X'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, FindSolutionWithSymmetriesVisitsFewerNodes)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeHashingMinimax hashingMinimax(CHashingMinimaxResolver(state.m_player), CreateConfig<CTicTacToeHashingMinimax>());
+        CTicTacToeSymmetricMinimax symmetricMinimax(CSymmetricMinimaxResolver(state.m_player), CreateConfig<CTicTacToeSymmetricMinimax>());
+
+        hashingMinimax.FindSolution(state);
+        symmetricMinimax.FindSolution(state);
+
+        EXPECT_LT(symmetricMinimax.GetDebugInfo().m_totalVisitedNodesCnt, hashingMinimax.GetDebugInfo().m_totalVisitedNodesCnt);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithSymmetriesReturnsMovesOfSearchedState)
+    {
+        std::vector<STicTacToeState> const states = {
+            { {"X--", "-O-", "---"}, 'X' },
+            { {"--X", "-O-", "---"}, 'X' },
+            { {"---", "-O-", "--X"}, 'X' },
+            { {"XO-", "-X-", "---"}, 'O' },
+            { {"-OX", "-X-", "---"}, 'O' },
+        };
+        auto config = CreateConfig<CTicTacToeSymmetricMinimax>();
+        config.m_useIterativeDeepening = true;
+        config.m_multiPVCount = 2;
+        config.m_collectPrincipalVariations = true;
+        for (auto const& state : states)
+        {
+            CTicTacToeSymmetricMinimax symmetricMinimax(CSymmetricMinimaxResolver(state.m_player), config);
+            CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateConfig<CTicTacToeMinimax>());
+
+            auto const result = symmetricMinimax.Search(state);
+
+            EXPECT_FLOAT_EQ(result.m_score, minimax.Search(state).m_score);
+            for (auto const& rootMove : result.m_rootMoves)
+            {
+                STicTacToeState pvState = state;
+                for (auto const& move : rootMove.m_principalVariation)
+                {
+                    ASSERT_EQ(pvState.m_map[move.first][move.second], '-');
+                    mimax_test::games::tic_tac_toe::MakeMove(pvState, move);
+                }
+            }
+            ASSERT_TRUE(result.m_move.has_value());
+            STicTacToeState childState = state;
+            mimax_test::games::tic_tac_toe::MakeMove(childState, result.m_move.value());
+            CTicTacToeMinimax childMinimax(CMinimaxResolver(childState.m_player), CreateConfig<CTicTacToeMinimax>());
+            EXPECT_FLOAT_EQ(-childMinimax.Search(childState).m_score, result.m_score);
+        }
+    }
+
+    static CTicTacToeMinimax::SConfig CreateIterativeDeepeningConfig()
+    {
+        auto config = CreateConfig<CTicTacToeMinimax>();
+        config.m_useIterativeDeepening = true;
+        return config;
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithIterativeDeepeningSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            },
+            'D',
+            CreateIterativeDeepeningConfig()
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithIterativeDeepeningSpecifiedStateReturnsWinnerO)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner(
+            {
+                {"O--",
+                 "XOX",
+                 "--X"}, 'O'
+            },
+            'O',
+            CreateIterativeDeepeningConfig()
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithIterativeDeepeningReturnsScoreOfEveryDepth)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateIterativeDeepeningConfig());
+
+        auto const result = minimax.Search(state);
+
+        EXPECT_TRUE(result.m_move.has_value());
+        EXPECT_EQ(result.m_completedDepth, 9u);
+        EXPECT_EQ(result.m_iterationScores.size(), 9u);
+        EXPECT_FLOAT_EQ(result.m_score, 0.0f);
+    }
+
+    class CStoppingMinimaxResolver : public CMinimaxResolver
+    {
+    public:
+        CStoppingMinimaxResolver(char const myPlayer, std::function<void()>* stopFunc, size_t const evaluationsBeforeStop)
+            : CMinimaxResolver(myPlayer)
+            , m_stopFunc(stopFunc)
+            , m_evaluationsBeforeStop(evaluationsBeforeStop)
+        {}
+
+        float EvaluateState(STicTacToeState const& state)
+        {
+            if (m_evaluationsBeforeStop > 0 && --m_evaluationsBeforeStop == 0)
+                (*m_stopFunc)();
+            return CMinimaxResolver::EvaluateState(state);
+        }
+
+    private:
+        std::function<void()>* m_stopFunc;
+        size_t m_evaluationsBeforeStop;
+    };
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithIterativeDeepeningStoppedReturnsLastCompletedDepth)
+    {
+        using CStoppingMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CStoppingMinimaxResolver, SMinimaxDebugInfo>;
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        std::function<void()> stopFunc;
+        auto config = CreateConfig<CStoppingMinimax>();
+        config.m_useIterativeDeepening = true;
+        CStoppingMinimax minimax(CStoppingMinimaxResolver(state.m_player, &stopFunc, 200), config);
+        stopFunc = [&minimax]() { minimax.StopAlgorithm(); };
+
+        auto const result = minimax.Search(state);
+
+        EXPECT_TRUE(result.m_move.has_value());
+        EXPECT_GE(result.m_completedDepth, 1u);
+        EXPECT_LT(result.m_completedDepth, 9u);
+        EXPECT_EQ(result.m_iterationScores.size(), result.m_completedDepth);
+    }
+
+    static CTicTacToeMoveIndexingMinimax::SConfig CreateMoveOrderingConfig()
+    {
+        auto config = CreateConfig<CTicTacToeMoveIndexingMinimax>();
+        config.m_useKillerMoves = true;
+        config.m_moveIndicesCount = 3 * 3;
+        return config;
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithMoveOrderingSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeMoveIndexingMinimax, CMoveIndexingMinimaxResolver>(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            },
+            'D',
+            CreateMoveOrderingConfig()
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithMoveOrderingSpecifiedStateReturnsWinnerX)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeMoveIndexingMinimax, CMoveIndexingMinimaxResolver>(
+            {
+                {"-OO",
+                 "XXO",
+                 "--X"}, 'X'
+            },
+            'X',
+            CreateMoveOrderingConfig()
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, FindSolutionWithMoveOrderingVisitsFewerNodes)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateConfig<CTicTacToeMinimax>());
+        CTicTacToeMoveIndexingMinimax orderingMinimax(CMoveIndexingMinimaxResolver(state.m_player), CreateMoveOrderingConfig());
+
+        minimax.FindSolution(state);
+        orderingMinimax.FindSolution(state);
+
+        EXPECT_LT(orderingMinimax.GetDebugInfo().m_totalVisitedNodesCnt, minimax.GetDebugInfo().m_totalVisitedNodesCnt);
+    }
+
+    static CTicTacToeMinimax::SConfig CreatePrincipalVariationSearchConfig()
+    {
+        auto config = CreateIterativeDeepeningConfig();
+        config.m_usePrincipalVariationSearch = true;
+        config.m_aspirationWindow = 0.5f;
+        return config;
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithPrincipalVariationSearchSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            },
+            'D',
+            CreatePrincipalVariationSearchConfig()
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithPrincipalVariationSearchSpecifiedStateReturnsWinnerX)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner(
+            {
+                {"X--",
+                 "-O-",
+                 "O-X"}, 'X'
+            },
+            'X',
+            CreatePrincipalVariationSearchConfig()
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithPrincipalVariationSearchReturnsSameScores)
+    {
+        std::vector<STicTacToeState> const states = {
+            { {"---", "---", "---"}, 'X' },
+            { {"X--", "-O-", "O-X"}, 'X' },
+            { {"O--", "XOX", "--X"}, 'O' },
+            { {"X--", "-O-", "--X"}, 'O' }
+        };
+        for (auto const& state : states)
+        {
+            CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateIterativeDeepeningConfig());
+            CTicTacToeMinimax pvsMinimax(CMinimaxResolver(state.m_player), CreatePrincipalVariationSearchConfig());
+
+            auto const result = minimax.Search(state);
+            auto const pvsResult = pvsMinimax.Search(state);
+
+            EXPECT_EQ(pvsResult.m_iterationScores, result.m_iterationScores);
+        }
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithUndoMoveSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeUndoingMinimax, CUndoingMinimaxResolver>(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            },
+            'D'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithUndoMoveSpecifiedStateReturnsWinnerO)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeUndoingMinimax, CUndoingMinimaxResolver>(
+            {
+                {"O--",
+                 "XOX",
+                 "--X"}, 'O'
+            },
+            'O'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithUndoMoveSpecifiedStateNotEntersUnexpectedStates)
+    {
+        auto findNextMoveFunc = CreateFindNextMoveFunc<CTicTacToeUndoingMinimax, CUndoingMinimaxResolver>(
+            CreateConfig<CTicTacToeUndoingMinimax>(),
+            {
+                { {"-OO", "XXO", "XOX"}, 'X' },
+                { {"-OO", "XXO", "OXX"}, 'X' }
+            });
+
+        mimax_test::games::tic_tac_toe::PlayGame({ {"-OO", "XXO", "--X"}, 'X' }, findNextMoveFunc);
+    }
+
+    static CTicTacToeQuiescenceMinimax::SConfig CreateShallowConfig(size_t const maxQuiescenceDepth)
+    {
+        auto config = CreateConfig<CTicTacToeQuiescenceMinimax>();
+        config.m_maxDepth = 1;
+        config.m_maxQuiescenceDepth = maxQuiescenceDepth;
+        return config;
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, FindSolutionShallowWithoutQuiescenceMissesThreat)
+    {
+        STicTacToeState const state = { {"X--", "--X", "OO-"}, 'X' };
+        CTicTacToeQuiescenceMinimax minimax(CQuiescenceMinimaxResolver(state.m_player), CreateShallowConfig(0));
+
+        auto const move = minimax.FindSolution(state);
+
+        ASSERT_TRUE(move.has_value());
+        EXPECT_NE(move.value(), STicTacToeMove(2, 2));
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, FindSolutionShallowWithQuiescenceBlocksThreat)
+    {
+        STicTacToeState const state = { {"X--", "--X", "OO-"}, 'X' };
+        CTicTacToeQuiescenceMinimax minimax(CQuiescenceMinimaxResolver(state.m_player), CreateShallowConfig(2));
+
+        auto const move = minimax.FindSolution(state);
+
+        ASSERT_TRUE(move.has_value());
+        EXPECT_EQ(move.value(), STicTacToeMove(2, 2));
+        EXPECT_GT(minimax.GetDebugInfo().m_quiescenceNodesCnt, 0u);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithQuiescenceSpecifiedStateReturnsWinnerX)
+    {
+        auto config = CreateConfig<CTicTacToeQuiescenceMinimax>();
+        config.m_maxQuiescenceDepth = 2;
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeQuiescenceMinimax, CQuiescenceMinimaxResolver>(
+            {
+                {"X--",
+                 "-O-",
+                 "O-X"}, 'X'
+            },
+            'X',
+            config
+        );
+    }
+
+    static CTicTacToeNullMoveMinimax::SConfig CreateReductionsConfig()
+    {
+        auto config = CreateConfig<CTicTacToeNullMoveMinimax>();
+        config.m_useKillerMoves = true;
+        config.m_usePrincipalVariationSearch = true;
+        config.m_nullMoveReduction = 1;
+        config.m_lateMoveMinIndex = 3;
+        return config;
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithReductionsSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeNullMoveMinimax, CNullMoveMinimaxResolver>(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            },
+            'D',
+            CreateReductionsConfig()
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithReductionsSpecifiedStateReturnsWinnerX)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeNullMoveMinimax, CNullMoveMinimaxResolver>(
+            {
+                {"X--",
+                 "-O-",
+                 "O-X"}, 'X'
+            },
+            'X',
+            CreateReductionsConfig()
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, FindSolutionWithReductionsBlocksThreat)
+    {
+        STicTacToeState const state = { {"X--", "--X", "OO-"}, 'X' };
+        CTicTacToeNullMoveMinimax minimax(CNullMoveMinimaxResolver(state.m_player), CreateReductionsConfig());
+
+        auto const move = minimax.FindSolution(state);
+
+        ASSERT_TRUE(move.has_value());
+        EXPECT_EQ(move.value(), STicTacToeMove(2, 2));
+        EXPECT_GT(minimax.GetDebugInfo().m_nullMoveCutoffsCnt, 0u);
+        EXPECT_GT(minimax.GetDebugInfo().m_lateMoveReductionsCnt, 0u);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithAccumulatorSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeAccumulatingMinimax, CAccumulatingMinimaxResolver>(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            },
+            'D'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithAccumulatorSpecifiedStateReturnsWinnerX)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeAccumulatingMinimax, CAccumulatingMinimaxResolver>(
+            {
+                {"X--",
+                 "-O-",
+                 "O-X"}, 'X'
+            },
+            'X'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithAccumulatorReturnsSameScore)
+    {
+        STicTacToeState const state = { {"X--", "-O-", "--X"}, 'O' };
+        CTicTacToeAccumulatingMinimax accumulatingMinimax(CAccumulatingMinimaxResolver(state.m_player), CreateConfig<CTicTacToeAccumulatingMinimax>());
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateConfig<CTicTacToeMinimax>());
+
+        auto const result = accumulatingMinimax.Search(state);
+        auto const expectedResult = minimax.Search(state);
+
+        EXPECT_FLOAT_EQ(result.m_score, expectedResult.m_score);
+    }
+
+    static CTicTacToeBatchingMinimax::SConfig CreateBatchedEvaluationConfig()
+    {
+        auto config = CreateConfig<CTicTacToeBatchingMinimax>();
+        config.m_useBatchedEvaluation = true;
+        return config;
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithBatchedEvaluationSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeBatchingMinimax, CBatchingMinimaxResolver>(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            },
+            'D',
+            CreateBatchedEvaluationConfig()
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchShallowWithBatchedEvaluationReturnsSameScore)
+    {
+        STicTacToeState const state = { {"X--", "-O-", "--X"}, 'O' };
+        auto batchingConfig = CreateBatchedEvaluationConfig();
+        batchingConfig.m_maxDepth = 3;
+        auto config = CreateConfig<CTicTacToeMinimax>();
+        config.m_maxDepth = 3;
+        CTicTacToeBatchingMinimax batchingMinimax(CBatchingMinimaxResolver(state.m_player), batchingConfig);
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), config);
+
+        auto const result = batchingMinimax.Search(state);
+        auto const expectedResult = minimax.Search(state);
+
+        EXPECT_FLOAT_EQ(result.m_score, expectedResult.m_score);
+        EXPECT_GT(batchingMinimax.GetDebugInfo().m_evaluatedBatchesCnt, 0u);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithBatchedEvaluationCountsFrontierNodes)
+    {
+        STicTacToeState const state = { {"X--", "-O-", "--X"}, 'O' };
+        auto config = CreateBatchedEvaluationConfig();
+        config.m_maxDepth = 3;
+        CTicTacToeBatchingMinimax minimax(CBatchingMinimaxResolver(state.m_player), config);
+
+        auto const result = minimax.Search(state);
+
+        EXPECT_EQ(result.m_visitedNodesCnt, minimax.GetDebugInfo().m_totalVisitedNodesCnt);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithBatchedEvaluationAndNodesLimitStopsSearch)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        auto config = CreateBatchedEvaluationConfig();
+        config.m_useIterativeDeepening = true;
+        CTicTacToeBatchingMinimax minimax(CBatchingMinimaxResolver(state.m_player), config);
+        mimax::dma::SSearchLimits limits;
+        limits.m_maxNodes = 200;
+
+        auto const result = minimax.Search(state, limits);
+
+        EXPECT_TRUE(result.m_move.has_value());
+        EXPECT_LT(result.m_completedDepth, 9u);
+        EXPECT_LE(result.m_visitedNodesCnt, 200u + 9u);
+        EXPECT_LE(minimax.GetDebugInfo().m_totalVisitedNodesCnt, 200u + 9u);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithBatchedEvaluationAndTranspositionTableReturnsSameScore)
+    {
+        std::vector<STicTacToeState> const states = {
+            { {"---", "---", "---"}, 'X' },
+            { {"X--", "-O-", "--X"}, 'O' },
+            { {"X--", "-O-", "O-X"}, 'X' }
+        };
+        size_t transpositionHitsCnt = 0;
+        for (auto const& state : states)
+        {
+            auto config = CreateConfig<CTicTacToeBatchingHashingMinimax>();
+            config.m_useBatchedEvaluation = true;
+            CTicTacToeBatchingHashingMinimax batchingMinimax(CBatchingHashingMinimaxResolver(state.m_player), config);
+            CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateConfig<CTicTacToeMinimax>());
+
+            auto const result = batchingMinimax.Search(state);
+            auto const expectedResult = minimax.Search(state);
+
+            EXPECT_FLOAT_EQ(result.m_score, expectedResult.m_score);
+            transpositionHitsCnt += batchingMinimax.GetDebugInfo().m_transpositionHitsCnt;
+        }
+        EXPECT_GT(transpositionHitsCnt, 0u);
+    }
+
+    static CTicTacToeHashingMinimax::SConfig CreateKeepingSearchDataConfig()
+    {
+        auto config = CreateConfig<CTicTacToeHashingMinimax>();
+        config.m_useKillerMoves = true;
+        config.m_keepSearchData = true;
+        return config;
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchKeepingSearchDataRepeatedVisitsFewerNodes)
+    {
+        STicTacToeState const state = { {"X--", "-O-", "--X"}, 'O' };
+        CTicTacToeHashingMinimax minimax(CHashingMinimaxResolver(state.m_player), CreateKeepingSearchDataConfig());
+
+        auto const firstResult = minimax.Search(state);
+        size_t const firstVisitedNodesCnt = minimax.GetDebugInfo().m_totalVisitedNodesCnt;
+        auto const secondResult = minimax.Search(state);
+
+        EXPECT_FLOAT_EQ(secondResult.m_score, firstResult.m_score);
+        EXPECT_LT(minimax.GetDebugInfo().m_totalVisitedNodesCnt, firstVisitedNodesCnt);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithTranspositionTableReturnsPonderMove)
+    {
+        STicTacToeState const state = { {"X--", "-O-", "--X"}, 'O' };
+        CTicTacToeHashingMinimax minimax(CHashingMinimaxResolver(state.m_player), CreateConfig<CTicTacToeHashingMinimax>());
+
+        auto const result = minimax.Search(state);
+
+        ASSERT_TRUE(result.m_move.has_value());
+        EXPECT_TRUE(result.m_ponderMove.has_value());
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGamePonderingSpecifiedStateReturnsDraw)
+    {
+        auto const config = CreateKeepingSearchDataConfig();
+        auto const minimaxX = std::make_shared<CTicTacToeHashingMinimax>(CHashingMinimaxResolver('X'), config);
+        auto const minimaxO = std::make_shared<CTicTacToeHashingMinimax>(CHashingMinimaxResolver('O'), config);
+        auto const findNextMoveFunc = [minimaxX, minimaxO](STicTacToeState const& state) {
+            auto& minimax = state.m_player == 'X' ? *minimaxX : *minimaxO;
+            auto const result = minimax.Search(state);
+            EXPECT_FALSE(minimax.IsPondering());
+
+            STicTacToeState childState = state;
+            mimax_test::games::tic_tac_toe::MakeMove(childState, result.m_move.value());
+            if (result.m_ponderMove.has_value())
+            {
+                minimax.StartPondering(childState, result.m_ponderMove.value());
+            }
+            return result.m_move.value();
+        };
+
+        auto const winner = mimax_test::games::tic_tac_toe::PlayGame({ {"---", "---", "---"}, 'X' }, findNextMoveFunc);
+        minimaxX->StopPondering();
+        minimaxO->StopPondering();
+
+        EXPECT_EQ(winner, 'D');
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchAfterPonderHitVisitsFewerNodes)
+    {
+        STicTacToeState const state = { {"X--", "---", "---"}, 'O' };
+        auto const config = CreateKeepingSearchDataConfig();
+        CTicTacToeHashingMinimax minimax(CHashingMinimaxResolver(state.m_player), config);
+        auto const result = minimax.Search(state);
+        ASSERT_TRUE(result.m_ponderMove.has_value());
+        STicTacToeState childState = state;
+        mimax_test::games::tic_tac_toe::MakeMove(childState, result.m_move.value());
+        STicTacToeState ponderState = childState;
+        mimax_test::games::tic_tac_toe::MakeMove(ponderState, result.m_ponderMove.value());
+        CTicTacToeHashingMinimax coldMinimax(CHashingMinimaxResolver(state.m_player), config);
+
+        minimax.StartPondering(childState, result.m_ponderMove.value());
+        while (!minimax.IsPonderingFinished())
+        {
+            std::this_thread::yield();
+        }
+        auto const ponderHitResult = minimax.Search(ponderState);
+        auto const coldResult = coldMinimax.Search(ponderState);
+
+        EXPECT_FALSE(minimax.IsPondering());
+        EXPECT_FLOAT_EQ(ponderHitResult.m_score, coldResult.m_score);
+        EXPECT_LT(ponderHitResult.m_visitedNodesCnt, coldResult.m_visitedNodesCnt);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithNodesLimitStopsAfterCompletedDepth)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateIterativeDeepeningConfig());
+        mimax::dma::SSearchLimits limits;
+        limits.m_maxNodes = 200;
+
+        auto const result = minimax.Search(state, limits);
+
+        EXPECT_TRUE(result.m_move.has_value());
+        EXPECT_GT(result.m_completedDepth, 0u);
+        EXPECT_LT(result.m_completedDepth, 9u);
+        EXPECT_LE(result.m_visitedNodesCnt, 200u + 9u);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithDepthLimitCompletesLimitDepth)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateIterativeDeepeningConfig());
+        mimax::dma::SSearchLimits limits;
+        limits.m_maxDepth = 2;
+
+        auto const result = minimax.Search(state, limits);
+
+        EXPECT_EQ(result.m_completedDepth, 2u);
+    }
+
+    // every evaluation takes longer than the soft time of the tests
+    class CSlowMinimaxResolver : public CMinimaxResolver
+    {
+    public:
+        using CMinimaxResolver::CMinimaxResolver;
+
+        float EvaluateState(STicTacToeState const& state)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(10));
+            return CMinimaxResolver::EvaluateState(state);
+        }
+    };
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithSoftTimeSpentCompletesFirstDepth)
+    {
+        using CTicTacToeSlowMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CSlowMinimaxResolver>;
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        auto config = CreateConfig<CTicTacToeSlowMinimax>();
+        config.m_useIterativeDeepening = true;
+        CTicTacToeSlowMinimax minimax(CSlowMinimaxResolver(state.m_player), config);
+        mimax::dma::SSearchLimits limits;
+        limits.m_softTime = std::chrono::microseconds(1);
+
+        auto const result = minimax.Search(state, limits);
+
+        EXPECT_EQ(result.m_completedDepth, 1u);
+        EXPECT_TRUE(result.m_move.has_value());
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithPassedDeadlineStopsImmediately)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateIterativeDeepeningConfig());
+        mimax::dma::SSearchLimits limits;
+        limits.m_deadline = mimax::dma::SSearchLimits::Clock::now();
+        limits.m_checkTimeInterval = 1;
+
+        auto const result = minimax.Search(state, limits);
+
+        EXPECT_EQ(result.m_completedDepth, 0u);
+        EXPECT_FALSE(minimax.IsStopRequested());
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchAfterStopBetweenSearchesReturnsNoMove)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateIterativeDeepeningConfig());
+        minimax.Search(state);
+
+        // e.g. the owner stopping a search which another thread hasn't started yet
+        minimax.StopAlgorithm();
+        auto const stoppedResult = minimax.Search(state);
+        auto const result = minimax.Search(state);
+
+        EXPECT_FALSE(stoppedResult.m_move.has_value());
+        EXPECT_TRUE(result.m_move.has_value());
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchAfterResetStopRequestReturnsMove)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateIterativeDeepeningConfig());
+        minimax.Search(state);
+
+        // e.g. a tasks runner stopping a task whose search has just finished
+        minimax.StopAlgorithm();
+        minimax.ResetStopRequest();
+        auto const result = minimax.Search(state);
+
+        EXPECT_TRUE(result.m_move.has_value());
+        EXPECT_EQ(result.m_completedDepth, 9u);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, RunAsTaskStoppedBeforeRunReturnsNoMove)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateIterativeDeepeningConfig());
+        mimax::dma::CMinimaxTask<CTicTacToeMinimax> task(&minimax, state);
+
+        task.PrepareTask();
+        task.StopTask();
+        task.RunTask();
+
+        EXPECT_FALSE(task.GetResult().has_value());
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, RunAsTaskRepeatedReturnsMove)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateIterativeDeepeningConfig());
+        mimax::dma::CMinimaxTask<CTicTacToeMinimax> task(&minimax, state);
+        mimax::mt::CTasksRunner tasksRunner;
+
+        for (size_t i = 0; i < 2; ++i)
+        {
+            tasksRunner.RunTasksAndWait({ &task }, std::chrono::seconds(10));
+
+            EXPECT_TRUE(task.GetResult().has_value()) << "run " << i;
+        }
+        EXPECT_TRUE(minimax.Search(state).m_move.has_value());
+    }
+
+    // score of every root move from the root player point of view, each by its own search
+    static std::vector<float> GetRootMoveScores(STicTacToeState const& state, CTicTacToeMovesContainer const& moves)
+    {
+        std::vector<float> scores;
+        for (auto const& move : moves)
+        {
+            STicTacToeState childState = state;
+            mimax_test::games::tic_tac_toe::MakeMove(childState, move);
+            CTicTacToeMinimax minimax(CMinimaxResolver(childState.m_player), CreateConfig<CTicTacToeMinimax>());
+            scores.push_back(-minimax.Search(childState).m_score);
+        }
+        return scores;
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchMultiPVReturnsExactScoresOfBestMoves)
+    {
+        STicTacToeState const state = { {"X--", "-O-", "--X"}, 'O' };
+        CTicTacToeMovesContainer moves;
+        mimax_test::games::tic_tac_toe::GetPossibleMoves(moves, state);
+        auto const scores = GetRootMoveScores(state, moves);
+        auto sortedScores = scores;
+        std::sort(sortedScores.begin(), sortedScores.end(), std::greater<float>());
+        auto config = CreateIterativeDeepeningConfig();
+        config.m_multiPVCount = 5;
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), config);
+
+        auto const result = minimax.Search(state);
+
+        ASSERT_EQ(result.m_rootMoves.size(), 5u);
+        EXPECT_EQ(result.m_move.value(), result.m_rootMoves.front().m_move);
+        for (size_t i = 0; i < result.m_rootMoves.size(); ++i)
+        {
+            auto const& rootMove = result.m_rootMoves[i];
+            size_t const moveIndex = std::find(moves.begin(), moves.end(), rootMove.m_move) - moves.begin();
+            ASSERT_LT(moveIndex, moves.size());
+            EXPECT_FLOAT_EQ(rootMove.m_score, scores[moveIndex]);
+            EXPECT_FLOAT_EQ(rootMove.m_score, sortedScores[i]);
+        }
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchMultiPVWithTranspositionTableReturnsPrincipalVariations)
+    {
+        STicTacToeState const state = { {"X--", "-O-", "--X"}, 'O' };
+        auto config = CreateConfig<CTicTacToeHashingMinimax>();
+        config.m_multiPVCount = 3;
+        config.m_collectPrincipalVariations = true;
+        CTicTacToeHashingMinimax minimax(CHashingMinimaxResolver(state.m_player), config);
+
+        auto const result = minimax.Search(state);
+
+        ASSERT_EQ(result.m_rootMoves.size(), 3u);
+        for (auto const& rootMove : result.m_rootMoves)
+        {
+            ASSERT_FALSE(rootMove.m_principalVariation.empty());
+            EXPECT_EQ(rootMove.m_principalVariation.front(), rootMove.m_move);
+            STicTacToeState pvState = state;
+            for (auto const& move : rootMove.m_principalVariation)
+            {
+                CTicTacToeMovesContainer moves;
+                mimax_test::games::tic_tac_toe::GetPossibleMoves(moves, pvState);
+                ASSERT_THAT(moves, testing::Contains(move));
+                mimax_test::games::tic_tac_toe::MakeMove(pvState, move);
+            }
+        }
+        EXPECT_GT(result.m_rootMoves.front().m_principalVariation.size(), 1u);
+    }
+
+    static CTicTacToeHashingMinimax::SConfig CreateMTDfConfig()
+    {
+        auto config = CreateConfig<CTicTacToeHashingMinimax>();
+        config.m_useIterativeDeepening = true;
+        config.m_useMTDf = true;
+        return config;
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithMTDfSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeHashingMinimax, CHashingMinimaxResolver>(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            }, 'D', CreateMTDfConfig());
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithMTDfReturnsSameScore)
+    {
+        std::vector<STicTacToeState> const states = {
+            { {"X--", "-O-", "--X"}, 'O' },
+            { {"XO-", "-X-", "---"}, 'O' },
+            { {"X-O", "---", "---"}, 'X' },
+        };
+        for (auto const& state : states)
+        {
+            CTicTacToeHashingMinimax mtdfMinimax(CHashingMinimaxResolver(state.m_player), CreateMTDfConfig());
+            CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateConfig<CTicTacToeMinimax>());
+
+            auto const result = mtdfMinimax.Search(state);
+            auto const expectedResult = minimax.Search(state);
+
+            EXPECT_FLOAT_EQ(result.m_score, expectedResult.m_score);
+            ASSERT_TRUE(result.m_move.has_value());
+            STicTacToeState childState = state;
+            mimax_test::games::tic_tac_toe::MakeMove(childState, result.m_move.value());
+            CTicTacToeMinimax childMinimax(CMinimaxResolver(childState.m_player), CreateConfig<CTicTacToeMinimax>());
+            EXPECT_FLOAT_EQ(-childMinimax.Search(childState).m_score, expectedResult.m_score);
+            EXPECT_GT(mtdfMinimax.GetDebugInfo().m_zeroWindowSearchesCnt, 0u);
+        }
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithoutStatisticsReturnsSameScore)
+    {
+        using CNoStatisticsMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CMinimaxResolver>;
+        static_assert(std::is_empty<mimax::dma::SNoMinimaxStatistics>::value, "the no-op statistics must not hold data");
+        STicTacToeState const state = { {"X--", "-O-", "--X"}, 'O' };
+        CNoStatisticsMinimax noStatisticsMinimax(CMinimaxResolver(state.m_player), CreateConfig<CNoStatisticsMinimax>());
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateConfig<CTicTacToeMinimax>());
+
+        auto const result = noStatisticsMinimax.Search(state);
+        auto const expectedResult = minimax.Search(state);
+
+        EXPECT_FLOAT_EQ(result.m_score, expectedResult.m_score);
+        EXPECT_EQ(result.m_visitedNodesCnt, expectedResult.m_visitedNodesCnt);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithStatisticsCollectsBranchingFactorCutoffsAndDepthTimes)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateIterativeDeepeningConfig());
+
+        auto const result = minimax.Search(state);
+
+        auto const& statistics = minimax.GetDebugInfo();
+        EXPECT_GT(statistics.GetBranchingFactor(), 1.0);
+        EXPECT_LE(statistics.GetBranchingFactor(), 9.0);
+        size_t cutoffsCnt = 0;
+        for (size_t const cnt : statistics.m_cutoffMoveIndicesCnt)
+        {
+            cutoffsCnt += cnt;
+        }
+        EXPECT_GT(cutoffsCnt, 0u);
+        EXPECT_GE(statistics.m_cutoffMoveIndicesCnt[0], statistics.m_cutoffMoveIndicesCnt[8]);
+        double searchTime = 0.0;
+        for (size_t depth = 1; depth <= result.m_completedDepth; ++depth)
+        {
+            EXPECT_GE(statistics.m_depthTimes[depth], 0.0);
+            searchTime += statistics.m_depthTimes[depth];
+        }
+        EXPECT_GT(searchTime, 0.0);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, WriteJsonStatisticsWritesAllCounters)
+    {
+        STicTacToeState const state = { {"X--", "-O-", "--X"}, 'O' };
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateConfig<CTicTacToeMinimax>());
+        minimax.Search(state);
+        std::ostringstream stream;
+
+        mimax::dma::WriteJson(stream, minimax.GetDebugInfo());
+
+        std::string const json = stream.str();
+        ASSERT_FALSE(json.empty());
+        EXPECT_EQ(json.front(), '{');
+        EXPECT_EQ(json.back(), '}');
+        EXPECT_NE(json.find("\"visitedNodes\":" + std::to_string(minimax.GetDebugInfo().m_totalVisitedNodesCnt)), std::string::npos);
+        EXPECT_NE(json.find("\"branchingFactor\":"), std::string::npos);
+        EXPECT_NE(json.find("\"cutoffMoveIndices\":["), std::string::npos);
+        EXPECT_NE(json.find("\"depthTimes\":["), std::string::npos);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PrintStatisticsBeyondMaxDepthPrintsOnlyStoredDepths)
+    {
+        SMinimaxDebugInfo statistics;
+        statistics.VisitNode(SMinimaxDebugInfo::MAX_DEPTH);
+        std::ostringstream stream;
+
+        stream << statistics;
+
+        std::string const text = stream.str();
+        std::string const lastDepth = std::to_string(SMinimaxDebugInfo::MAX_DEPTH);
+        EXPECT_NE(text.find("\n" + lastDepth + ": "), std::string::npos);
+        EXPECT_EQ(text.find("\n" + std::to_string(SMinimaxDebugInfo::MAX_DEPTH + 1) + ": "), std::string::npos);
+    }
+
 } // minimax
 } // dma
 } // mimax_test
\ No newline at end of file
@@ -0,0 +1,195 @@
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "mimax/dma/MinimaxBase.h"
+#include "mimax/dma/MinimaxIterative.h"
+
+#include "mimax_test/dma/MinimaxTicTacToeResolvers.h"
+#include "mimax_test/games/TicTacToeGame.h"
+
+namespace mimax_test {
+namespace dma {
+namespace minimax_iterative {
+
+    using namespace mimax_test::dma::minimax;
+
+    using CTicTacToeMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CMinimaxResolver, mimax::dma::SMinimaxDebugInfo>;
+    using CTicTacToeIterative = mimax::dma::CMinimaxIterative<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CMinimaxResolver, mimax::dma::SMinimaxDebugInfo>;
+    using CTicTacToeHashingIterative = mimax::dma::CMinimaxIterative<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CHashingMinimaxResolver>;
+
+    static size_t s_movesAllocationsCnt = 0;
+
+    // counts the allocations of the moves containers, which the search default constructs
+    template<typename T>
+    struct SCountingAllocator
+    {
+        using value_type = T;
+
+        SCountingAllocator() = default;
+        template<typename U>
+        SCountingAllocator(SCountingAllocator<U> const&) {}
+
+        T* allocate(size_t const n)
+        {
+            ++s_movesAllocationsCnt;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* const ptr, size_t const n)
+        {
+            std::allocator<T>().deallocate(ptr, n);
+        }
+
+        template<typename U>
+        bool operator==(SCountingAllocator<U> const&) const { return true; }
+        template<typename U>
+        bool operator!=(SCountingAllocator<U> const&) const { return false; }
+    };
+
+    using CCountingMovesContainer = std::vector<STicTacToeMove, SCountingAllocator<STicTacToeMove>>;
+
+    class CCountingMovesMinimaxResolver : public CHashingMinimaxResolver
+    {
+    public:
+        using CHashingMinimaxResolver::CHashingMinimaxResolver;
+
+        void GetPossibleMoves(CCountingMovesContainer& movesOut, STicTacToeState const& state)
+        {
+            mimax_test::games::tic_tac_toe::GetPossibleMoves(movesOut, state);
+        }
+    };
+
+    class CStoppingMinimaxResolver : public CMinimaxResolver
+    {
+    public:
+        CStoppingMinimaxResolver(char const myPlayer, std::function<void()>* stopFunc, size_t const evaluationsBeforeStop)
+            : CMinimaxResolver(myPlayer)
+            , m_stopFunc(stopFunc)
+            , m_evaluationsBeforeStop(evaluationsBeforeStop)
+        {}
+
+        float EvaluateState(STicTacToeState const& state)
+        {
+            if (m_evaluationsBeforeStop > 0 && --m_evaluationsBeforeStop == 0)
+                (*m_stopFunc)();
+            return CMinimaxResolver::EvaluateState(state);
+        }
+
+    private:
+        std::function<void()>* m_stopFunc;
+        size_t m_evaluationsBeforeStop;
+    };
+
+    template<typename TIterative, typename TResolver>
+    static void PlayGame_SpecifiedState_ReturnsExpectedWinner(STicTacToeState const& state, char const expectedWinner)
+    {
+        auto const findNextMoveFunc = [](STicTacToeState const& state) {
+            TIterative iterative(TResolver(state.m_player), CreateConfig<TIterative>());
+            return iterative.FindSolution(state).value();
+        };
+
+        auto const winner = mimax_test::games::tic_tac_toe::PlayGame(state, findNextMoveFunc);
+
+        EXPECT_EQ(winner, expectedWinner);
+    }
+
+    GTEST_TEST(DmaCMinimaxIterativeTicTacToe, PlayGameSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeIterative, CMinimaxResolver>(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            },
+            'D'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxIterativeTicTacToe, PlayGameSpecifiedStateReturnsWinnerX)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeIterative, CMinimaxResolver>(
+            {
+                {"X--",
+                 "-O-",
+                 "O-X"}, 'X'
+            },
+            'X'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxIterativeTicTacToe, PlayGameWithTranspositionTableSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner<CTicTacToeHashingIterative, CHashingMinimaxResolver>(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            },
+            'D'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxIterativeTicTacToe, SearchSpecifiedStateReturnsRecursiveScoreAndNodesCount)
+    {
+        STicTacToeState const state = { {"X--", "-O-", "--X"}, 'O' };
+        CTicTacToeIterative iterative(CMinimaxResolver(state.m_player), CreateConfig<CTicTacToeIterative>());
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateConfig<CTicTacToeMinimax>());
+
+        auto const result = iterative.Search(state);
+        auto const expectedResult = minimax.Search(state);
+
+        EXPECT_EQ(result.m_move, expectedResult.m_move);
+        EXPECT_FLOAT_EQ(result.m_score, expectedResult.m_score);
+        EXPECT_EQ(iterative.GetDebugInfo().m_totalVisitedNodesCnt, minimax.GetDebugInfo().m_totalVisitedNodesCnt);
+    }
+
+    GTEST_TEST(DmaCMinimaxIterativeTicTacToe, SearchRepeatedReturnsSameResult)
+    {
+        STicTacToeState const state = { {"X--", "-O-", "--X"}, 'O' };
+        CTicTacToeIterative iterative(CMinimaxResolver(state.m_player), CreateConfig<CTicTacToeIterative>());
+
+        auto const firstResult = iterative.Search(state);
+        auto const secondResult = iterative.Search(state);
+
+        EXPECT_EQ(secondResult.m_move, firstResult.m_move);
+        EXPECT_FLOAT_EQ(secondResult.m_score, firstResult.m_score);
+    }
+
+    GTEST_TEST(DmaCMinimaxIterativeTicTacToe, SearchRepeatedDoesNotAllocateMoves)
+    {
+        using CCountingIterative = mimax::dma::CMinimaxIterative<STicTacToeState, STicTacToeMove, CCountingMovesContainer, CCountingMovesMinimaxResolver>;
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CCountingIterative iterative(CCountingMovesMinimaxResolver(state.m_player), CreateConfig<CCountingIterative>());
+        // the first search grows the moves containers to their steady capacity
+        iterative.Search(state);
+        size_t const allocationsCnt = s_movesAllocationsCnt;
+
+        auto const result = iterative.Search(state);
+
+        EXPECT_GT(allocationsCnt, 0u);
+        EXPECT_EQ(s_movesAllocationsCnt, allocationsCnt);
+        EXPECT_TRUE(result.m_move.has_value());
+    }
+
+    GTEST_TEST(DmaCMinimaxIterativeTicTacToe, SearchStoppedReturnsNoMove)
+    {
+        using CStoppingIterative = mimax::dma::CMinimaxIterative<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CStoppingMinimaxResolver>;
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        std::function<void()> stopFunc;
+        CStoppingIterative iterative(CStoppingMinimaxResolver(state.m_player, &stopFunc, 5), CreateConfig<CStoppingIterative>());
+        stopFunc = [&iterative]() { iterative.StopAlgorithm(); };
+
+        auto const stoppedResult = iterative.Search(state);
+        auto const result = iterative.Search(state);
+
+        EXPECT_FALSE(stoppedResult.m_move.has_value());
+        EXPECT_TRUE(result.m_move.has_value());
+    }
+
+} // minimax_iterative
+} // dma
+} // mimax_test
@@ -0,0 +1,160 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "mimax/dma/MinimaxLazySMP.h"
+#include "mimax/dma/tasks/MinimaxTask.h"
+#include "mimax/mt/TasksRunner.h"
+
+#include "mimax_test/dma/MinimaxTicTacToeResolvers.h"
+#include "mimax_test/games/TicTacToeGame.h"
+
+namespace mimax_test {
+namespace dma {
+namespace minimax_lazy_smp {
+
+    using namespace mimax_test::dma::minimax;
+
+    using CTicTacToeMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CHashingMinimaxResolver>;
+    using CTicTacToeLazySMP = mimax::dma::CMinimaxLazySMP<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CHashingMinimaxResolver>;
+
+    static CTicTacToeLazySMP::SConfig CreateLazySMPConfig()
+    {
+        CTicTacToeLazySMP::SConfig config;
+        config.m_minimaxConfig = CreateConfig<CTicTacToeMinimax>();
+        config.m_threadsCount = 4;
+        return config;
+    }
+
+    static void PlayGame_SpecifiedState_ReturnsExpectedWinner(STicTacToeState const& state, char const expectedWinner)
+    {
+        auto const findNextMoveFunc = [](STicTacToeState const& state) {
+            CTicTacToeLazySMP lazySMP(CHashingMinimaxResolver(state.m_player), CreateLazySMPConfig());
+            return lazySMP.FindSolution(state).value();
+        };
+
+        auto const winner = mimax_test::games::tic_tac_toe::PlayGame(state, findNextMoveFunc);
+
+        EXPECT_EQ(winner, expectedWinner);
+    }
+
+    GTEST_TEST(DmaCMinimaxLazySMPTicTacToe, ConstructorSpecifiedThreadsCountCreatesSearchers)
+    {
+        CTicTacToeLazySMP lazySMP(CHashingMinimaxResolver('X'), CreateLazySMPConfig());
+
+        EXPECT_EQ(lazySMP.GetSearchersCount(), 4u);
+    }
+
+    GTEST_TEST(DmaCMinimaxLazySMPTicTacToe, PlayGameSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            },
+            'D'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxLazySMPTicTacToe, PlayGameSpecifiedStateReturnsWinnerX)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner(
+            {
+                {"X--",
+                 "-O-",
+                 "O-X"}, 'X'
+            },
+            'X'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxLazySMPTicTacToe, SearchSpecifiedStateReturnsSingleThreadScore)
+    {
+        STicTacToeState const state = { {"X--", "-O-", "--X"}, 'O' };
+        CTicTacToeLazySMP lazySMP(CHashingMinimaxResolver(state.m_player), CreateLazySMPConfig());
+        auto config = CreateConfig<CTicTacToeMinimax>();
+        config.m_useIterativeDeepening = true;
+        CTicTacToeMinimax minimax(CHashingMinimaxResolver(state.m_player), config);
+
+        auto const result = lazySMP.Search(state);
+        auto const expectedResult = minimax.Search(state);
+
+        EXPECT_EQ(result.m_completedDepth, expectedResult.m_completedDepth);
+        EXPECT_FLOAT_EQ(result.m_score, expectedResult.m_score);
+    }
+
+    GTEST_TEST(DmaCMinimaxLazySMPTicTacToe, SearchKeepingSearchDataRepeatedVisitsFewerNodes)
+    {
+        STicTacToeState const state = { {"X--", "-O-", "--X"}, 'O' };
+        auto config = CreateLazySMPConfig();
+        config.m_minimaxConfig.m_keepSearchData = true;
+        config.m_threadsCount = 1;
+        CTicTacToeLazySMP lazySMP(CHashingMinimaxResolver(state.m_player), config);
+
+        auto const firstResult = lazySMP.Search(state);
+        auto const secondResult = lazySMP.Search(state);
+
+        EXPECT_FLOAT_EQ(secondResult.m_score, firstResult.m_score);
+        EXPECT_LT(secondResult.m_visitedNodesCnt, firstResult.m_visitedNodesCnt);
+    }
+
+    // every evaluation yields the thread, so a full search takes much longer than starting a thread
+    class CSlowHashingMinimaxResolver : public CHashingMinimaxResolver
+    {
+    public:
+        using CHashingMinimaxResolver::CHashingMinimaxResolver;
+
+        float EvaluateState(STicTacToeState const& state)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(10));
+            return CHashingMinimaxResolver::EvaluateState(state);
+        }
+    };
+
+    GTEST_TEST(DmaCMinimaxLazySMPTicTacToe, SearchStoppedBeforeHelpersStartReturnsImmediately)
+    {
+        using CTicTacToeSlowLazySMP = mimax::dma::CMinimaxLazySMP<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CSlowHashingMinimaxResolver>;
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        auto config = CreateConfig<CTicTacToeMinimax>();
+        config.m_useIterativeDeepening = true;
+        CTicTacToeMinimax minimax(CHashingMinimaxResolver(state.m_player), config);
+        size_t const fullSearchVisitedNodesCnt = minimax.Search(state).m_visitedNodesCnt;
+        CTicTacToeSlowLazySMP::SConfig lazySMPConfig;
+        lazySMPConfig.m_minimaxConfig = CreateConfig<CTicTacToeSlowLazySMP::Minimax>();
+        lazySMPConfig.m_threadsCount = 4;
+        CTicTacToeSlowLazySMP lazySMP(CSlowHashingMinimaxResolver(state.m_player), lazySMPConfig);
+        mimax::dma::SSearchLimits limits;
+        limits.m_maxNodes = 1;
+
+        for (size_t run = 0; run < 10; ++run)
+        {
+            auto const result = lazySMP.Search(state, limits);
+
+            EXPECT_EQ(result.m_visitedNodesCnt, 1u);
+            for (size_t i = 1; i < lazySMP.GetSearchersCount(); ++i)
+            {
+                // a helper reaching its search after the stop returns at its first node
+                EXPECT_LT(lazySMP.GetSearcher(i).GetVisitedNodesCount(), fullSearchVisitedNodesCnt / 2) << "run " << run << ", helper " << i;
+            }
+        }
+    }
+
+    GTEST_TEST(DmaCMinimaxLazySMPTicTacToe, RunAsTaskReturnsMove)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeLazySMP lazySMP(CHashingMinimaxResolver(state.m_player), CreateLazySMPConfig());
+        mimax::dma::CMinimaxTask<CTicTacToeLazySMP> task(&lazySMP, state);
+        mimax::mt::CTasksRunner tasksRunner;
+
+        tasksRunner.RunTasksAndWait({ &task }, std::chrono::milliseconds(10));
+
+        EXPECT_TRUE(task.GetResult().has_value());
+    }
+
+} // minimax_lazy_smp
+} // dma
+} // mimax_test
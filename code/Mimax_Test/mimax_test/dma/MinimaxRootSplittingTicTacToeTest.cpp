@@ -0,0 +1,163 @@
+#include <chrono>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "mimax/dma/MinimaxRootSplitting.h"
+#include "mimax/dma/tasks/MinimaxTask.h"
+#include "mimax/mt/TasksRunner.h"
+
+#include "mimax_test/dma/MinimaxTicTacToeResolvers.h"
+#include "mimax_test/games/TicTacToeGame.h"
+
+namespace mimax_test {
+namespace dma {
+namespace minimax_root_splitting {
+
+    using namespace mimax_test::dma::minimax;
+
+    using CTicTacToeMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CHashingMinimaxResolver>;
+    using CTicTacToeRootSplitting = mimax::dma::CMinimaxRootSplitting<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CHashingMinimaxResolver>;
+
+    static CTicTacToeRootSplitting::SConfig CreateRootSplittingConfig()
+    {
+        CTicTacToeRootSplitting::SConfig config;
+        config.m_minimaxConfig = CreateConfig<CTicTacToeMinimax>();
+        config.m_minimaxConfig.m_useIterativeDeepening = true;
+        config.m_minimaxConfig.m_usePrincipalVariationSearch = true;
+        config.m_threadsCount = 4;
+        return config;
+    }
+
+    static void PlayGame_SpecifiedState_ReturnsExpectedWinner(STicTacToeState const& state, char const expectedWinner)
+    {
+        auto const findNextMoveFunc = [](STicTacToeState const& state) {
+            CTicTacToeRootSplitting rootSplitting(CHashingMinimaxResolver(state.m_player), CreateRootSplittingConfig());
+            return rootSplitting.FindSolution(state).value();
+        };
+
+        auto const winner = mimax_test::games::tic_tac_toe::PlayGame(state, findNextMoveFunc);
+
+        EXPECT_EQ(winner, expectedWinner);
+    }
+
+    GTEST_TEST(DmaCMinimaxRootSplittingTicTacToe, ConstructorSpecifiedThreadsCountCreatesSearchers)
+    {
+        CTicTacToeRootSplitting rootSplitting(CHashingMinimaxResolver('X'), CreateRootSplittingConfig());
+
+        EXPECT_EQ(rootSplitting.GetSearchersCount(), 4u);
+    }
+
+    GTEST_TEST(DmaCMinimaxRootSplittingTicTacToe, PlayGameSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            },
+            'D'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxRootSplittingTicTacToe, PlayGameSpecifiedStateReturnsWinnerX)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner(
+            {
+                {"X--",
+                 "-O-",
+                 "O-X"}, 'X'
+            },
+            'X'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxRootSplittingTicTacToe, SearchSpecifiedStatesReturnsSingleThreadScore)
+    {
+        std::vector<STicTacToeState> const states = {
+            { {"X--", "-O-", "--X"}, 'O' },
+            { {"XO-", "-X-", "---"}, 'O' },
+            { {"X-O", "---", "---"}, 'X' },
+            { {"XX-", "OO-", "---"}, 'X' },
+        };
+        for (auto const& state : states)
+        {
+            CTicTacToeRootSplitting rootSplitting(CHashingMinimaxResolver(state.m_player), CreateRootSplittingConfig());
+            CTicTacToeMinimax minimax(CHashingMinimaxResolver(state.m_player), CreateConfig<CTicTacToeMinimax>());
+
+            auto const result = rootSplitting.Search(state);
+            auto const expectedResult = minimax.Search(state);
+
+            EXPECT_EQ(result.m_completedDepth, 9u);
+            EXPECT_FLOAT_EQ(result.m_score, expectedResult.m_score);
+            ASSERT_TRUE(result.m_move.has_value());
+            STicTacToeState childState = state;
+            mimax_test::games::tic_tac_toe::MakeMove(childState, result.m_move.value());
+            CTicTacToeMinimax childMinimax(CHashingMinimaxResolver(childState.m_player), CreateConfig<CTicTacToeMinimax>());
+            EXPECT_FLOAT_EQ(-childMinimax.Search(childState).m_score, expectedResult.m_score);
+        }
+    }
+
+    GTEST_TEST(DmaCMinimaxRootSplittingTicTacToe, SearchWithDepthLimitCompletesLimitDepth)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeRootSplitting rootSplitting(CHashingMinimaxResolver(state.m_player), CreateRootSplittingConfig());
+        mimax::dma::SSearchLimits limits;
+        limits.m_maxDepth = 3;
+
+        auto const result = rootSplitting.Search(state, limits);
+
+        EXPECT_EQ(result.m_completedDepth, 3u);
+        EXPECT_EQ(result.m_iterationScores.size(), 3u);
+        EXPECT_GT(result.m_visitedNodesCnt, 0u);
+    }
+
+    GTEST_TEST(DmaCMinimaxRootSplittingTicTacToe, RunAsTaskReturnsMove)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeRootSplitting rootSplitting(CHashingMinimaxResolver(state.m_player), CreateRootSplittingConfig());
+        mimax::dma::CMinimaxTask<CTicTacToeRootSplitting> task(&rootSplitting, state);
+        mimax::mt::CTasksRunner tasksRunner;
+
+        // the runner stops the task after a search which finished early, the next run must not be affected
+        for (size_t i = 0; i < 2; ++i)
+        {
+            tasksRunner.RunTasksAndWait({ &task }, std::chrono::seconds(10));
+
+            EXPECT_TRUE(task.GetResult().has_value()) << "run " << i;
+        }
+    }
+
+    GTEST_TEST(DmaCMinimaxRootSplittingTicTacToe, SearchAfterStopBetweenSearchesReturnsNoMove)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeRootSplitting rootSplitting(CHashingMinimaxResolver(state.m_player), CreateRootSplittingConfig());
+        rootSplitting.Search(state);
+
+        // e.g. the owner stopping a search which another thread hasn't started yet
+        rootSplitting.StopAlgorithm();
+        auto const stoppedResult = rootSplitting.Search(state);
+        auto const result = rootSplitting.Search(state);
+
+        EXPECT_FALSE(stoppedResult.m_move.has_value());
+        EXPECT_TRUE(result.m_move.has_value());
+        EXPECT_EQ(result.m_completedDepth, 9u);
+    }
+
+    GTEST_TEST(DmaCMinimaxRootSplittingTicTacToe, RunAsTaskStoppedBeforeRunReturnsNoMove)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeRootSplitting rootSplitting(CHashingMinimaxResolver(state.m_player), CreateRootSplittingConfig());
+        mimax::dma::CMinimaxTask<CTicTacToeRootSplitting> task(&rootSplitting, state);
+
+        task.PrepareTask();
+        task.StopTask();
+        task.RunTask();
+
+        EXPECT_FALSE(task.GetResult().has_value());
+    }
+
+} // minimax_root_splitting
+} // dma
+} // mimax_test
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "mimax/common/ZobristKeys.h"
+
+#include "mimax_test/games/TicTacToeGame.h"
+
+namespace mimax_test {
+namespace dma {
+namespace minimax {
+
+    using STicTacToeMove = mimax_test::games::tic_tac_toe::SMove;
+    using STicTacToeState = mimax_test::games::tic_tac_toe::SGameState;
+    using CTicTacToeMovesContainer = std::vector<STicTacToeMove>;
+    using FindNextMoveFunc = mimax_test::games::tic_tac_toe::FindNextMoveFunc;
+
+    class CMinimaxResolver
+    {
+    public:
+        CMinimaxResolver(char const myPlayer)
+            : m_myPlayer(myPlayer)
+        {}
+
+        CMinimaxResolver(char const myPlayer, std::vector<STicTacToeState> const& unexpectedStates)
+            : m_myPlayer(myPlayer)
+            , m_unexpectedStates(unexpectedStates)
+        {}
+
+        float EvaluateState(STicTacToeState const& state)
+        {
+            CheckUnexpectedStates(state);
+            char const winner = mimax_test::games::tic_tac_toe::GetWinner(state);
+            if (winner == '-' || winner == 'D') return 0.0f;
+            return winner == m_myPlayer ? 1.0f : -1.0f;
+        }
+
+        void GetPossibleMoves(CTicTacToeMovesContainer& movesOut, STicTacToeState const& state)
+        {
+            CheckUnexpectedStates(state);
+            mimax_test::games::tic_tac_toe::GetPossibleMoves(movesOut, state);
+        }
+
+        void MakeMove(STicTacToeState& state, STicTacToeMove const move)
+        {
+            CheckUnexpectedStates(state);
+            mimax_test::games::tic_tac_toe::MakeMove(state, move);
+        }
+
+    protected:
+        std::vector<STicTacToeState> m_unexpectedStates;
+        char m_myPlayer;
+
+    private:
+        // returns early without the matcher, which allocates on every call
+        void CheckUnexpectedStates(STicTacToeState const& state)
+        {
+            if (m_unexpectedStates.empty()) return;
+            EXPECT_THAT(m_unexpectedStates, testing::Not(testing::Contains(state)));
+        }
+    };
+
+    class CHashingMinimaxResolver : public CMinimaxResolver
+    {
+    public:
+        using CMinimaxResolver::CMinimaxResolver;
+
+        uint64_t GetHash(STicTacToeState const& state)
+        {
+            static mimax::common::CZobristKeys const keys(3 * 3 * 2 + 1, 1234567890ULL);
+            uint64_t hash = state.m_player == 'X' ? keys.GetKey(3 * 3 * 2) : 0;
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int j = 0; j < 3; ++j)
+                {
+                    char const cell = state.m_map[i][j];
+                    if (cell != '-')
+                        hash ^= keys.GetKey((i * 3 + j) * 2 + (cell == 'X' ? 0 : 1));
+                }
+            }
+            return hash;
+        }
+    };
+
+    class CSymmetricMinimaxResolver : public CHashingMinimaxResolver
+    {
+    public:
+        using CHashingMinimaxResolver::CHashingMinimaxResolver;
+
+        // the smallest of the 8 rotations and reflections of the board
+        size_t CanonicalizeState(STicTacToeState const& state, STicTacToeState& canonicalStateOut)
+        {
+            size_t canonicalSymmetry = 0;
+            canonicalStateOut = state;
+            for (size_t symmetry = 1; symmetry < 8; ++symmetry)
+            {
+                STicTacToeState transformedState = state;
+                for (int i = 0; i < 3; ++i)
+                {
+                    for (int j = 0; j < 3; ++j)
+                    {
+                        STicTacToeMove const cell = TransformMove({ i, j }, symmetry);
+                        transformedState.m_map[cell.first][cell.second] = state.m_map[i][j];
+                    }
+                }
+                if (IsLess(transformedState, canonicalStateOut))
+                {
+                    canonicalStateOut = transformedState;
+                    canonicalSymmetry = symmetry;
+                }
+            }
+            return canonicalSymmetry;
+        }
+
+        // bit 0 mirrors the columns, bit 1 the rows, bit 2 transposes
+        STicTacToeMove TransformMove(STicTacToeMove move, size_t const symmetry)
+        {
+            if (symmetry & 1) move.second = 2 - move.second;
+            if (symmetry & 2) move.first = 2 - move.first;
+            if (symmetry & 4) std::swap(move.first, move.second);
+            return move;
+        }
+
+        STicTacToeMove RestoreMove(STicTacToeMove move, size_t const symmetry)
+        {
+            if (symmetry & 4) std::swap(move.first, move.second);
+            if (symmetry & 2) move.first = 2 - move.first;
+            if (symmetry & 1) move.second = 2 - move.second;
+            return move;
+        }
+
+    private:
+        static bool IsLess(STicTacToeState const& lhs, STicTacToeState const& rhs)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                int const comparison = std::strncmp(lhs.m_map[i], rhs.m_map[i], 3);
+                if (comparison != 0)
+                    return comparison < 0;
+            }
+            return false;
+        }
+    };
+
+    class CMoveIndexingMinimaxResolver : public CMinimaxResolver
+    {
+    public:
+        using CMinimaxResolver::CMinimaxResolver;
+
+        size_t GetMoveIndex(STicTacToeMove const& move)
+        {
+            return move.first * 3 + move.second;
+        }
+    };
+
+    class CUndoingMinimaxResolver : public CMinimaxResolver
+    {
+    public:
+        using CMinimaxResolver::CMinimaxResolver;
+
+        void UndoMove(STicTacToeState& state, STicTacToeMove const move)
+        {
+            state.m_map[move.first][move.second] = '-';
+            state.m_player = state.m_player == 'X' ? 'O' : 'X';
+        }
+    };
+
+    class CQuiescenceMinimaxResolver : public CMinimaxResolver
+    {
+    public:
+        using CMinimaxResolver::CMinimaxResolver;
+
+        // moves which win immediately
+        void GetNoisyMoves(CTicTacToeMovesContainer& movesOut, STicTacToeState const& state)
+        {
+            CTicTacToeMovesContainer moves;
+            mimax_test::games::tic_tac_toe::GetPossibleMoves(moves, state);
+            movesOut.clear();
+            for (auto const& move : moves)
+            {
+                STicTacToeState childState = state;
+                mimax_test::games::tic_tac_toe::MakeMove(childState, move);
+                if (mimax_test::games::tic_tac_toe::GetWinner(childState) == state.m_player)
+                    movesOut.push_back(move);
+            }
+        }
+    };
+
+    class CNullMoveMinimaxResolver : public CMinimaxResolver
+    {
+    public:
+        using CMinimaxResolver::CMinimaxResolver;
+
+        // an extra move never hurts in tic-tac-toe, so passing is allowed until the game is over
+        bool MakeNullMove(STicTacToeState& state)
+        {
+            if (mimax_test::games::tic_tac_toe::GetWinner(state) != '-')
+                return false;
+
+            state.m_player = state.m_player == 'X' ? 'O' : 'X';
+            return true;
+        }
+    };
+
+    class CAccumulatingMinimaxResolver : public CMinimaxResolver
+    {
+    public:
+        // marks of both players in every row, column and diagonal
+        struct SAccumulator
+        {
+            int m_lineMarks[8][2] = {};
+        };
+        using Accumulator = SAccumulator;
+
+    public:
+        using CMinimaxResolver::CMinimaxResolver;
+
+        float EvaluateState(STicTacToeState const&)
+        {
+            ADD_FAILURE() << "leaves must be evaluated from the accumulator";
+            return 0.0f;
+        }
+
+        void InitializeAccumulator(SAccumulator& accumulatorOut, STicTacToeState const& state)
+        {
+            accumulatorOut = SAccumulator();
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int j = 0; j < 3; ++j)
+                {
+                    if (state.m_map[i][j] != '-')
+                        AddMark(accumulatorOut, i, j, state.m_map[i][j]);
+                }
+            }
+        }
+
+        void UpdateAccumulator(SAccumulator& childOut, SAccumulator const& parent, STicTacToeState const& parentState, STicTacToeMove const move)
+        {
+            childOut = parent;
+            AddMark(childOut, move.first, move.second, parentState.m_player);
+        }
+
+        float EvaluateAccumulator(SAccumulator const& accumulator, STicTacToeState const&)
+        {
+            for (auto const& lineMarks : accumulator.m_lineMarks)
+            {
+                if (lineMarks[0] == 3) return m_myPlayer == 'X' ? 1.0f : -1.0f;
+                if (lineMarks[1] == 3) return m_myPlayer == 'O' ? 1.0f : -1.0f;
+            }
+            return 0.0f;
+        }
+
+    private:
+        static void AddMark(SAccumulator& accumulator, int const row, int const column, char const player)
+        {
+            int const playerIndex = player == 'X' ? 0 : 1;
+            ++accumulator.m_lineMarks[row][playerIndex];
+            ++accumulator.m_lineMarks[3 + column][playerIndex];
+            if (row == column) ++accumulator.m_lineMarks[6][playerIndex];
+            if (row + column == 2) ++accumulator.m_lineMarks[7][playerIndex];
+        }
+    };
+
+    class CBatchingMinimaxResolver : public CMinimaxResolver
+    {
+    public:
+        using CMinimaxResolver::CMinimaxResolver;
+
+        void EvaluateStates(std::vector<STicTacToeState> const& states, std::vector<float>& scoresOut)
+        {
+            for (size_t i = 0; i < states.size(); ++i)
+            {
+                scoresOut[i] = EvaluateState(states[i]);
+            }
+        }
+    };
+
+    class CBatchingHashingMinimaxResolver : public CHashingMinimaxResolver
+    {
+    public:
+        using CHashingMinimaxResolver::CHashingMinimaxResolver;
+
+        void EvaluateStates(std::vector<STicTacToeState> const& states, std::vector<float>& scoresOut)
+        {
+            for (size_t i = 0; i < states.size(); ++i)
+            {
+                scoresOut[i] = EvaluateState(states[i]);
+            }
+        }
+    };
+
+    class CTablebaseMinimaxResolver : public CMinimaxResolver
+    {
+    public:
+        static constexpr size_t TABLEBASE_ENTRIES_COUNT = 19683; // 3^9
+
+    public:
+        using CMinimaxResolver::CMinimaxResolver;
+
+        // the board read as a base 3 number, the player to move follows from the marks count
+        bool GetTablebaseIndex(STicTacToeState const& state, size_t& indexOut)
+        {
+            indexOut = 0;
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int j = 0; j < 3; ++j)
+                {
+                    char const cell = state.m_map[i][j];
+                    indexOut = indexOut * 3 + (cell == '-' ? 0 : (cell == 'X' ? 1 : 2));
+                }
+            }
+            return true;
+        }
+    };
+
+    template<typename TMinimax>
+    inline typename TMinimax::SConfig CreateConfig()
+    {
+        typename TMinimax::SConfig config;
+        config.m_maxValue = 1.0f;
+        config.m_minValue = -1.0f;
+        config.m_maxDepth = 9;
+        config.m_epsilon = 0.1f;
+        config.m_transpositionTableSize = 1 << 12;
+        return config;
+    }
+
+} // minimax
+} // dma
+} // mimax_test
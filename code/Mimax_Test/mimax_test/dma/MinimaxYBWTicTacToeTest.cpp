@@ -0,0 +1,169 @@
+#include <functional>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "mimax/dma/MinimaxBase.h"
+#include "mimax/dma/MinimaxYBW.h"
+
+#include "mimax_test/dma/MinimaxTicTacToeResolvers.h"
+#include "mimax_test/games/TicTacToeGame.h"
+
+namespace mimax_test {
+namespace dma {
+namespace minimax_ybw {
+
+    using namespace mimax_test::dma::minimax;
+
+    using CTicTacToeMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CMinimaxResolver, mimax::dma::SMinimaxDebugInfo>;
+    using CTicTacToeYBW = mimax::dma::CMinimaxYBW<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CMinimaxResolver, mimax::dma::SMinimaxParallelDebugInfo>;
+
+    template<typename TYBW = CTicTacToeYBW>
+    static typename TYBW::SConfig CreateYBWConfig()
+    {
+        typename TYBW::SConfig config;
+        config.m_maxValue = 1.0f;
+        config.m_minValue = -1.0f;
+        config.m_maxDepth = 9;
+        config.m_epsilon = 0.1f;
+        config.m_threadsCount = 4;
+        config.m_minSplitDepth = 3;
+        return config;
+    }
+
+    static void PlayGame_SpecifiedState_ReturnsExpectedWinner(STicTacToeState const& state, char const expectedWinner)
+    {
+        auto const findNextMoveFunc = [](STicTacToeState const& state) {
+            CTicTacToeYBW ybw(CMinimaxResolver(state.m_player), CreateYBWConfig());
+            return ybw.FindSolution(state).value();
+        };
+
+        auto const winner = mimax_test::games::tic_tac_toe::PlayGame(state, findNextMoveFunc);
+
+        EXPECT_EQ(winner, expectedWinner);
+    }
+
+    GTEST_TEST(DmaCMinimaxYBWTicTacToe, PlayGameSpecifiedStateReturnsDraw)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner(
+            {
+                {"---",
+                 "---",
+                 "---"}, 'X'
+            },
+            'D'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxYBWTicTacToe, PlayGameSpecifiedStateReturnsWinnerX)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner(
+            {
+                {"-OO",
+                 "XXO",
+                 "--X"}, 'X'
+            },
+            'X'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxYBWTicTacToe, PlayGameSpecifiedStateReturnsWinnerO)
+    {
+        PlayGame_SpecifiedState_ReturnsExpectedWinner(
+            {
+                {"O--",
+                 "XOX",
+                 "--X"}, 'O'
+            },
+            'O'
+        );
+    }
+
+    GTEST_TEST(DmaCMinimaxYBWTicTacToe, FindSolutionSpecifiedStateReturnsExpectedMove)
+    {
+        STicTacToeState const state = { {"XXO", "-X-", "OO-"}, 'X' };
+        CTicTacToeYBW ybw(CMinimaxResolver(state.m_player), CreateYBWConfig());
+
+        auto const move = ybw.FindSolution(state);
+
+        ASSERT_TRUE(move.has_value());
+        EXPECT_EQ(move.value(), STicTacToeMove(2, 2));
+    }
+
+    GTEST_TEST(DmaCMinimaxYBWTicTacToe, FindSolutionWithSerialBaselineReportsOverhead)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        auto config = CreateYBWConfig();
+        config.m_measureSerialBaseline = true;
+        CTicTacToeYBW ybw(CMinimaxResolver(state.m_player), config);
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateConfig<CTicTacToeMinimax>());
+
+        ybw.FindSolution(state);
+        minimax.FindSolution(state);
+
+        auto const& debugInfo = ybw.GetDebugInfo();
+        EXPECT_EQ(debugInfo.m_serialVisitedNodesCnt, minimax.GetDebugInfo().m_totalVisitedNodesCnt);
+        EXPECT_GT(debugInfo.m_splitPointsCnt, 0u);
+        EXPECT_GT(debugInfo.m_splitPointCutoffsCnt, 0u);
+        EXPECT_LE(debugInfo.m_splitPointCutoffsCnt, debugInfo.m_splitPointsCnt);
+        EXPECT_TRUE(debugInfo.HasSerialBaseline());
+    }
+
+    GTEST_TEST(DmaCMinimaxYBWTicTacToe, FindSolutionSingleThreadVisitsSerialNodes)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        auto config = CreateYBWConfig();
+        config.m_threadsCount = 1;
+        config.m_measureSerialBaseline = true;
+        CTicTacToeYBW ybw(CMinimaxResolver(state.m_player), config);
+
+        ybw.FindSolution(state);
+
+        auto const& debugInfo = ybw.GetDebugInfo();
+        EXPECT_EQ(debugInfo.m_splitPointsCnt, 0u);
+        EXPECT_EQ(debugInfo.m_visitedNodesCnt, debugInfo.m_serialVisitedNodesCnt);
+        EXPECT_DOUBLE_EQ(debugInfo.GetSearchOverhead(), 0.0);
+    }
+
+    class CStoppingMinimaxResolver : public CMinimaxResolver
+    {
+    public:
+        CStoppingMinimaxResolver(char const myPlayer, std::function<void()> const* stopFunc, size_t const evaluationsBeforeStop)
+            : CMinimaxResolver(myPlayer)
+            , m_stopFunc(stopFunc)
+            , m_evaluationsBeforeStop(evaluationsBeforeStop)
+        {}
+
+        // every thread counts the evaluations of its own resolver copy
+        float EvaluateState(STicTacToeState const& state)
+        {
+            if (m_evaluationsBeforeStop > 0 && --m_evaluationsBeforeStop == 0)
+                (*m_stopFunc)();
+            return CMinimaxResolver::EvaluateState(state);
+        }
+
+    private:
+        std::function<void()> const* m_stopFunc;
+        size_t m_evaluationsBeforeStop;
+    };
+
+    GTEST_TEST(DmaCMinimaxYBWTicTacToe, FindSolutionStoppedReturnsNoMoveAndNextSearchReturnsMove)
+    {
+        using CStoppingYBW = mimax::dma::CMinimaxYBW<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CStoppingMinimaxResolver>;
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        std::function<void()> stopFunc;
+        CStoppingYBW ybw(CStoppingMinimaxResolver(state.m_player, &stopFunc, 100), CreateYBWConfig<CStoppingYBW>());
+        stopFunc = [&ybw]() { ybw.StopAlgorithm(); };
+
+        auto const stoppedMove = ybw.FindSolution(state);
+        stopFunc = []() {};
+        auto const move = ybw.FindSolution(state);
+
+        EXPECT_FALSE(stoppedMove.has_value());
+        EXPECT_TRUE(move.has_value());
+    }
+
+} // minimax_ybw
+} // dma
+} // mimax_test
@@ -0,0 +1,291 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "mimax/dma/MultiplayerMinimax.h"
+
+namespace mimax_test {
+namespace dma {
+namespace multiplayer_minimax {
+
+using namespace mimax::dma;
+using namespace std;
+
+static constexpr size_t PLAYERS_CNT = 3;
+static constexpr size_t MOVES_PER_PLAYER = 3;
+
+struct SMove
+{
+    size_t m_player = 0;
+    size_t m_index = 0;
+};
+
+// any player may move in any state, the game ends after a fixed number of moves
+struct SState
+{
+    vector<size_t> m_history;
+    size_t m_player = 0;
+};
+
+using CMovesContainer = vector<SMove>;
+using Scores = vector<float>;
+
+class CRandomGameResolver
+{
+public:
+    CRandomGameResolver(size_t const movesCnt, unsigned const seed) : m_movesCnt(movesCnt), m_seed(seed) {}
+
+    size_t GetPlayerToMove(SState const& state) const
+    {
+        return state.m_player;
+    }
+
+    void GetPossibleMoves(CMovesContainer& movesOut, SState const& state) const
+    {
+        GetPlayerMoves(movesOut, state, state.m_player);
+    }
+
+    void GetPlayerMoves(CMovesContainer& movesOut, SState const& state, size_t const player) const
+    {
+        if (state.m_history.size() >= m_movesCnt)
+            return;
+
+        for (size_t i = 0; i < MOVES_PER_PLAYER; ++i)
+        {
+            movesOut.push_back({ player, i });
+        }
+    }
+
+    void MakeMove(SState& state, SMove const& move) const
+    {
+        state.m_history.push_back(move.m_player * MOVES_PER_PLAYER + move.m_index);
+        state.m_player = (move.m_player + 1) % PLAYERS_CNT;
+    }
+
+    void SetPlayerToMove(SState& state, size_t const player) const
+    {
+        state.m_player = player;
+    }
+
+    // random non-negative scores summing to 1, the same for the same history
+    void EvaluateScores(Scores& scoresOut, SState const& state) const
+    {
+        uint64_t hash = 14695981039346656037ull ^ m_seed;
+        for (size_t const move : state.m_history)
+        {
+            hash = (hash ^ (move + 1)) * 1099511628211ull;
+        }
+        mt19937 generator(static_cast<unsigned>(hash ^ (hash >> 32)));
+        float sum = 0.0f;
+        for (auto& score : scoresOut)
+        {
+            score = uniform_real_distribution<float>(0.0f, 1.0f)(generator);
+            sum += score;
+        }
+        for (auto& score : scoresOut)
+        {
+            score /= sum;
+        }
+    }
+
+private:
+    size_t m_movesCnt;
+    unsigned m_seed;
+};
+
+using CRandomGameMinimax = CMultiplayerMinimax<SState, SMove, CMovesContainer, CRandomGameResolver, SMinimaxDebugInfo>;
+
+static Scores MaxN(CRandomGameResolver const& resolver, SState const& state)
+{
+    CMovesContainer moves;
+    resolver.GetPossibleMoves(moves, state);
+    if (moves.empty())
+    {
+        Scores scores(PLAYERS_CNT);
+        resolver.EvaluateScores(scores, state);
+        return scores;
+    }
+
+    Scores best;
+    for (auto const& move : moves)
+    {
+        SState childState = state;
+        resolver.MakeMove(childState, move);
+        Scores scores = MaxN(resolver, childState);
+        if (best.empty() || scores[state.m_player] > best[state.m_player])
+            best = scores;
+    }
+    return best;
+}
+
+// the score of rootPlayer, in the best-reply search the opponents' turns are merged into one
+static float Paranoid(CRandomGameResolver const& resolver, SState const& state, size_t const rootPlayer, bool const isBestReply)
+{
+    CMovesContainer moves;
+    if (isBestReply && state.m_player != rootPlayer)
+    {
+        for (size_t player = 0; player < PLAYERS_CNT; ++player)
+        {
+            if (player != rootPlayer)
+                resolver.GetPlayerMoves(moves, state, player);
+        }
+    }
+    else
+    {
+        resolver.GetPossibleMoves(moves, state);
+    }
+    if (moves.empty())
+    {
+        Scores scores(PLAYERS_CNT);
+        resolver.EvaluateScores(scores, state);
+        return scores[rootPlayer];
+    }
+
+    bool const isMax = state.m_player == rootPlayer;
+    float best = isMax ? -1.0f : 2.0f;
+    for (auto const& move : moves)
+    {
+        SState childState = state;
+        resolver.MakeMove(childState, move);
+        if (isBestReply && !isMax)
+            resolver.SetPlayerToMove(childState, rootPlayer);
+        float const score = Paranoid(resolver, childState, rootPlayer, isBestReply);
+        best = isMax ? max(best, score) : min(best, score);
+    }
+    return best;
+}
+
+static CRandomGameMinimax::SConfig CreateConfig(EMultiplayerSearch const search, size_t const maxDepth)
+{
+    CRandomGameMinimax::SConfig config;
+    config.m_playersCount = PLAYERS_CNT;
+    config.m_minValue = 0.0f;
+    config.m_maxValue = 1.0f;
+    config.m_maxScoresSum = 1.0f;
+    config.m_epsilon = 1e-6f;
+    config.m_maxDepth = maxDepth;
+    config.m_search = search;
+    return config;
+}
+
+static SState CreateRootState(unsigned const seed)
+{
+    SState state;
+    state.m_player = seed % PLAYERS_CNT;
+    return state;
+}
+
+GTEST_TEST(DmaCMultiplayerMinimax, SearchMaxNReturnsMaxNScores)
+{
+    for (unsigned seed = 1; seed <= 10; ++seed)
+    {
+        CRandomGameResolver const resolver(6, seed);
+        SState const rootState = CreateRootState(seed);
+        CRandomGameMinimax minimax(resolver, CreateConfig(EMultiplayerSearch::MaxN, 6));
+
+        auto const result = minimax.Search(rootState);
+
+        ASSERT_TRUE(result.m_move.has_value());
+        Scores const expectedScores = MaxN(resolver, rootState);
+        ASSERT_EQ(result.m_scores.size(), PLAYERS_CNT);
+        for (size_t i = 0; i < PLAYERS_CNT; ++i)
+        {
+            EXPECT_FLOAT_EQ(result.m_scores[i], expectedScores[i]) << "seed " << seed;
+        }
+
+        SState childState = rootState;
+        resolver.MakeMove(childState, result.m_move.value());
+        EXPECT_FLOAT_EQ(MaxN(resolver, childState)[rootState.m_player], expectedScores[rootState.m_player]) << "seed " << seed;
+    }
+}
+
+GTEST_TEST(DmaCMultiplayerMinimax, SearchParanoidReturnsParanoidScore)
+{
+    for (unsigned seed = 1; seed <= 10; ++seed)
+    {
+        CRandomGameResolver const resolver(6, seed);
+        SState const rootState = CreateRootState(seed);
+        CRandomGameMinimax minimax(resolver, CreateConfig(EMultiplayerSearch::Paranoid, 6));
+
+        auto const result = minimax.Search(rootState);
+
+        ASSERT_TRUE(result.m_move.has_value());
+        EXPECT_FLOAT_EQ(result.m_scores[rootState.m_player], Paranoid(resolver, rootState, rootState.m_player, false)) << "seed " << seed;
+    }
+}
+
+GTEST_TEST(DmaCMultiplayerMinimax, SearchBestReplyReturnsBestReplyScore)
+{
+    for (unsigned seed = 1; seed <= 10; ++seed)
+    {
+        CRandomGameResolver const resolver(6, seed);
+        SState const rootState = CreateRootState(seed);
+        CRandomGameMinimax minimax(resolver, CreateConfig(EMultiplayerSearch::BestReply, 6));
+
+        auto const result = minimax.Search(rootState);
+
+        ASSERT_TRUE(result.m_move.has_value());
+        EXPECT_EQ(result.m_move.value().m_player, rootState.m_player);
+        EXPECT_FLOAT_EQ(result.m_scores[rootState.m_player], Paranoid(resolver, rootState, rootState.m_player, true)) << "seed " << seed;
+    }
+}
+
+GTEST_TEST(DmaCMultiplayerMinimax, SearchLimitedDepthEvaluatesFrontier)
+{
+    CRandomGameResolver const resolver(6, 3);
+    SState const rootState = CreateRootState(0);
+    CRandomGameMinimax minimax(resolver, CreateConfig(EMultiplayerSearch::MaxN, 1));
+
+    auto const result = minimax.Search(rootState);
+
+    ASSERT_TRUE(result.m_move.has_value());
+    Scores expectedScores;
+    for (size_t i = 0; i < MOVES_PER_PLAYER; ++i)
+    {
+        SState childState = rootState;
+        resolver.MakeMove(childState, { rootState.m_player, i });
+        Scores scores(PLAYERS_CNT);
+        resolver.EvaluateScores(scores, childState);
+        if (expectedScores.empty() || scores[rootState.m_player] > expectedScores[rootState.m_player])
+            expectedScores = scores;
+    }
+    EXPECT_EQ(result.m_scores, expectedScores);
+    EXPECT_EQ(minimax.GetDebugInfo().m_evaluatedNodesCnt, MOVES_PER_PLAYER);
+}
+
+GTEST_TEST(DmaCMultiplayerMinimax, SearchWithShallowPruningVisitsFewerNodes)
+{
+    size_t visitedNodesCnt[3] = {};
+    size_t prunedNodesCnt[3] = {};
+    for (unsigned seed = 1; seed <= 10; ++seed)
+    {
+        CRandomGameResolver const resolver(6, seed);
+        SState const rootState = CreateRootState(seed);
+        CRandomGameMinimax::SConfig configs[3] = {
+            CreateConfig(EMultiplayerSearch::MaxN, 6),
+            CreateConfig(EMultiplayerSearch::MaxN, 6),
+            CreateConfig(EMultiplayerSearch::Paranoid, 6)
+        };
+        configs[0].m_useShallowPruning = false;
+        for (size_t i = 0; i < 3; ++i)
+        {
+            CRandomGameMinimax minimax(resolver, configs[i]);
+            minimax.Search(rootState);
+            visitedNodesCnt[i] += minimax.GetDebugInfo().m_totalVisitedNodesCnt;
+            prunedNodesCnt[i] += minimax.GetDebugInfo().m_totalPrunedNodesCnt;
+        }
+    }
+
+    EXPECT_EQ(prunedNodesCnt[0], 0u);
+    EXPECT_GT(prunedNodesCnt[1], 0u);
+    EXPECT_LT(visitedNodesCnt[1], visitedNodesCnt[0]);
+    // the paranoid coalition prunes deep, max^n only below a state's parent
+    EXPECT_LT(visitedNodesCnt[2], visitedNodesCnt[1]);
+}
+
+} // multiplayer_minimax
+} // dma
+} // mimax_test
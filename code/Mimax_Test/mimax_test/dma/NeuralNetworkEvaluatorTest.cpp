@@ -0,0 +1,77 @@
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <vector>
+
+#include "mimax/dma/NeuralNetworkEvaluator.h"
+#include "mimax/nn/Layer.h"
+#include "mimax/nn/NeuralNetwork.h"
+
+#include "mimax_mock/nn/LayerMock.h"
+
+namespace mimax_test {
+namespace dma {
+namespace neural_network_evaluator {
+
+using mimax::common::CMatrix;
+
+using namespace mimax_mock::nn;
+using namespace mimax::nn;
+using namespace std;
+
+struct STestEncoder
+{
+    void operator()(vector<float> const& state, CMatrix& inputOut, size_t const rowIndex) const
+    {
+        for (size_t i = 0; i < state.size(); ++i)
+        {
+            inputOut(rowIndex, i) = state[i];
+        }
+    }
+};
+
+using CTestEvaluator = mimax::dma::CNeuralNetworkEvaluator<vector<float>, STestEncoder>;
+
+// sums the inputs of every row, Activate is expected to be called activationsCount times
+static CNeuralNetwork CreateSumNetwork(size_t const inputsCount, int const activationsCount)
+{
+    auto layer = make_unique<CLayerNiceMock>();
+    EXPECT_CALL(*layer, Activate(testing::_, testing::_))
+        .Times(activationsCount)
+        .WillRepeatedly(
+            [inputsCount](CMatrix const& input, CMatrix& output)
+            {
+                output = input * CMatrix(inputsCount, 1, CMatrix::ScalarOne);
+            });
+    vector<unique_ptr<ILayer>> layers;
+    layers.emplace_back(move(layer));
+    return CNeuralNetwork(move(layers));
+}
+
+GTEST_TEST(DmaCNeuralNetworkEvaluator, EvaluateStateReturnsFirstOutput)
+{
+    auto network = CreateSumNetwork(3, 1);
+    CTestEvaluator evaluator(network, STestEncoder(), 3);
+
+    float const score = evaluator.EvaluateState({ 1.0f, 2.0f, 3.0f });
+
+    EXPECT_FLOAT_EQ(score, 6.0f);
+}
+
+GTEST_TEST(DmaCNeuralNetworkEvaluator, EvaluateStatesPredictsOnceAndReturnsScorePerState)
+{
+    auto network = CreateSumNetwork(2, 1);
+    CTestEvaluator evaluator(network, STestEncoder(), 2);
+    vector<float> scores;
+
+    evaluator.EvaluateStates({ { 1.0f, 2.0f }, { 3.0f, 4.0f }, { -1.0f, 0.5f } }, scores);
+
+    ASSERT_EQ(scores.size(), 3u);
+    EXPECT_FLOAT_EQ(scores[0], 3.0f);
+    EXPECT_FLOAT_EQ(scores[1], 7.0f);
+    EXPECT_FLOAT_EQ(scores[2], -0.5f);
+}
+
+} // neural_network_evaluator
+} // dma
+} // mimax_test
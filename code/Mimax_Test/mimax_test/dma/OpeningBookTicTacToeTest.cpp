@@ -0,0 +1,119 @@
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "mimax/dma/MinimaxBase.h"
+#include "mimax/dma/OpeningBook.h"
+#include "mimax/dma/OpeningBookBuilder.h"
+
+#include "mimax_test/dma/MinimaxTicTacToeResolvers.h"
+#include "mimax_test/games/TicTacToeGame.h"
+
+namespace mimax_test {
+namespace dma {
+namespace opening_book {
+
+    using namespace mimax_test::dma::minimax;
+    using mimax::dma::COpeningBook;
+    using mimax::dma::SOpeningBookEntry;
+
+    using CTicTacToeOpeningBookBuilder = mimax::dma::COpeningBookBuilder<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CHashingMinimaxResolver>;
+    using CTicTacToeHashingMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CHashingMinimaxResolver, mimax::dma::SMinimaxDebugInfo>;
+
+    static std::string GetOpeningBookPath()
+    {
+        return (std::filesystem::temp_directory_path() / "mimax_tic_tac_toe.mxob").string();
+    }
+
+    static STicTacToeState const EMPTY_STATE = { {"---", "---", "---"}, 'X' };
+
+    // the empty board and the 9 states after the first move
+    static std::vector<SOpeningBookEntry> BuildTicTacToeOpeningBook()
+    {
+        CTicTacToeOpeningBookBuilder::SConfig config;
+        config.m_searchConfig = CreateConfig<CTicTacToeOpeningBookBuilder::Minimax>();
+        config.m_maxPly = 2;
+        CTicTacToeOpeningBookBuilder builder([](STicTacToeState const& state) { return CHashingMinimaxResolver(state.m_player); }, config);
+        return builder.Build({ EMPTY_STATE });
+    }
+
+    GTEST_TEST(DmaCOpeningBookBuilderTicTacToe, BuildStoresBestMovesOfStatesUpToMaxPly)
+    {
+        auto const entries = BuildTicTacToeOpeningBook();
+
+        ASSERT_EQ(entries.size(), 10u);
+        for (auto const& entry : entries)
+        {
+            EXPECT_FLOAT_EQ(entry.m_score, 0.0f);
+            EXPECT_EQ(entry.m_depth, 9u);
+        }
+    }
+
+    GTEST_TEST(DmaCOpeningBookTicTacToe, OpenSavedOpeningBookProbesSavedEntries)
+    {
+        auto const entries = BuildTicTacToeOpeningBook();
+        ASSERT_TRUE(COpeningBook::Save(GetOpeningBookPath(), entries));
+        COpeningBook openingBook;
+
+        ASSERT_TRUE(openingBook.Open(GetOpeningBookPath()));
+
+        EXPECT_EQ(openingBook.GetEntriesCount(), entries.size());
+        for (auto const& entry : entries)
+        {
+            SOpeningBookEntry probedEntry;
+            ASSERT_TRUE(openingBook.Probe(entry.m_hash, probedEntry));
+            EXPECT_EQ(probedEntry.m_moveIndex, entry.m_moveIndex);
+        }
+        SOpeningBookEntry probedEntry;
+        EXPECT_FALSE(openingBook.Probe(CHashingMinimaxResolver('X').GetHash({ {"XO-", "---", "---"}, 'X' }), probedEntry));
+    }
+
+    GTEST_TEST(DmaCOpeningBookTicTacToe, OpenMissingFileReturnsFalse)
+    {
+        COpeningBook openingBook;
+
+        EXPECT_FALSE(openingBook.Open((std::filesystem::temp_directory_path() / "mimax_missing.mxob").string()));
+        EXPECT_FALSE(openingBook.IsOpen());
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithOpeningBookReturnsBookMoveWithoutSearching)
+    {
+        ASSERT_TRUE(COpeningBook::Save(GetOpeningBookPath(), BuildTicTacToeOpeningBook()));
+        COpeningBook openingBook;
+        ASSERT_TRUE(openingBook.Open(GetOpeningBookPath()));
+        STicTacToeState const state = { {"X--", "---", "---"}, 'O' };
+        CTicTacToeHashingMinimax minimax(CHashingMinimaxResolver(state.m_player), CreateConfig<CTicTacToeHashingMinimax>());
+        minimax.SetOpeningBook(&openingBook);
+
+        auto const result = minimax.Search(state);
+
+        EXPECT_EQ(minimax.GetDebugInfo().m_totalVisitedNodesCnt, 0u);
+        EXPECT_EQ(result.m_completedDepth, 9u);
+        ASSERT_TRUE(result.m_move.has_value());
+        STicTacToeState childState = state;
+        mimax_test::games::tic_tac_toe::MakeMove(childState, result.m_move.value());
+        CTicTacToeHashingMinimax childMinimax(CHashingMinimaxResolver(childState.m_player), CreateConfig<CTicTacToeHashingMinimax>());
+        EXPECT_FLOAT_EQ(-childMinimax.Search(childState).m_score, result.m_score);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithOpeningBookSpecifiedStateReturnsDraw)
+    {
+        ASSERT_TRUE(COpeningBook::Save(GetOpeningBookPath(), BuildTicTacToeOpeningBook()));
+        COpeningBook openingBook;
+        ASSERT_TRUE(openingBook.Open(GetOpeningBookPath()));
+        auto const findNextMoveFunc = [&openingBook](STicTacToeState const& state) {
+            CTicTacToeHashingMinimax minimax(CHashingMinimaxResolver(state.m_player), CreateConfig<CTicTacToeHashingMinimax>());
+            minimax.SetOpeningBook(&openingBook);
+            return minimax.FindSolution(state).value();
+        };
+
+        auto const winner = mimax_test::games::tic_tac_toe::PlayGame(EMPTY_STATE, findNextMoveFunc);
+
+        EXPECT_EQ(winner, 'D');
+    }
+
+} // opening_book
+} // dma
+} // mimax_test
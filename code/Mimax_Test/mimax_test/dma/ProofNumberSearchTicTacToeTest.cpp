@@ -0,0 +1,123 @@
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "mimax/dma/MinimaxBase.h"
+#include "mimax/dma/ProofNumberSearch.h"
+
+#include "mimax_test/dma/MinimaxTicTacToeResolvers.h"
+#include "mimax_test/games/TicTacToeGame.h"
+
+namespace mimax_test {
+namespace dma {
+namespace proof_number_search {
+
+    using namespace mimax_test::dma::minimax;
+    using mimax::dma::EProofResult;
+
+    using CTicTacToeProofNumberSearch = mimax::dma::CProofNumberSearch<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CHashingMinimaxResolver>;
+    using CTicTacToeSymmetricProofNumberSearch = mimax::dma::CProofNumberSearch<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CSymmetricMinimaxResolver>;
+    using CTicTacToeMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CMinimaxResolver>;
+
+    static CTicTacToeProofNumberSearch::SConfig CreateProofNumberConfig()
+    {
+        CTicTacToeProofNumberSearch::SConfig config;
+        config.m_tableSize = 1 << 12;
+        return config;
+    }
+
+    static float GetMinimaxScore(STicTacToeState const& state)
+    {
+        CTicTacToeMinimax minimax(CMinimaxResolver(state.m_player), CreateConfig<CTicTacToeMinimax>());
+        return minimax.Search(state).m_score;
+    }
+
+    // the states after the first three moves of a game
+    static std::vector<STicTacToeState> GetThirdPlyStates()
+    {
+        std::vector<STicTacToeState> states = { { {"---", "---", "---"}, 'X' } };
+        for (int ply = 0; ply < 3; ++ply)
+        {
+            std::vector<STicTacToeState> nextStates;
+            for (auto const& state : states)
+            {
+                CTicTacToeMovesContainer moves;
+                mimax_test::games::tic_tac_toe::GetPossibleMoves(moves, state);
+                for (auto const& move : moves)
+                {
+                    nextStates.push_back(state);
+                    mimax_test::games::tic_tac_toe::MakeMove(nextStates.back(), move);
+                }
+            }
+            states.swap(nextStates);
+        }
+        return states;
+    }
+
+    GTEST_TEST(DmaCProofNumberSearchTicTacToe, SolveEmptyStateReturnsNotWin)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeProofNumberSearch search(CHashingMinimaxResolver(state.m_player), CreateProofNumberConfig());
+
+        auto const result = search.Solve(state);
+
+        EXPECT_EQ(result.m_result, EProofResult::NotWin);
+        EXPECT_FALSE(result.m_move.has_value());
+    }
+
+    GTEST_TEST(DmaCProofNumberSearchTicTacToe, SolveForkStateReturnsWinningMove)
+    {
+        STicTacToeState const state = { {"X--", "-O-", "O-X"}, 'X' };
+        CTicTacToeProofNumberSearch search(CHashingMinimaxResolver(state.m_player), CreateProofNumberConfig());
+
+        auto const result = search.Solve(state);
+
+        ASSERT_EQ(result.m_result, EProofResult::Win);
+        ASSERT_TRUE(result.m_move.has_value());
+        STicTacToeState childState = state;
+        mimax_test::games::tic_tac_toe::MakeMove(childState, result.m_move.value());
+        EXPECT_FLOAT_EQ(GetMinimaxScore(childState), -1.0f);
+    }
+
+    GTEST_TEST(DmaCProofNumberSearchTicTacToe, SolveThirdPlyStatesMatchesMinimax)
+    {
+        for (auto const& state : GetThirdPlyStates())
+        {
+            CTicTacToeProofNumberSearch search(CHashingMinimaxResolver(state.m_player), CreateProofNumberConfig());
+
+            auto const result = search.Solve(state);
+
+            bool const isWin = GetMinimaxScore(state) > 0.0f;
+            EXPECT_EQ(result.m_result, isWin ? EProofResult::Win : EProofResult::NotWin);
+        }
+    }
+
+    GTEST_TEST(DmaCProofNumberSearchTicTacToe, SolveWithSymmetriesVisitsFewerNodes)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeProofNumberSearch search(CHashingMinimaxResolver(state.m_player), CreateProofNumberConfig());
+        CTicTacToeSymmetricProofNumberSearch symmetricSearch(CSymmetricMinimaxResolver(state.m_player), { 1 << 12 });
+
+        auto const result = search.Solve(state);
+        auto const symmetricResult = symmetricSearch.Solve(state);
+
+        EXPECT_EQ(symmetricResult.m_result, EProofResult::NotWin);
+        EXPECT_LT(symmetricResult.m_visitedNodesCnt, result.m_visitedNodesCnt);
+    }
+
+    GTEST_TEST(DmaCProofNumberSearchTicTacToe, SolveWithNodesLimitReturnsUnknown)
+    {
+        STicTacToeState const state = { {"---", "---", "---"}, 'X' };
+        CTicTacToeProofNumberSearch search(CHashingMinimaxResolver(state.m_player), CreateProofNumberConfig());
+        mimax::dma::SSearchLimits limits;
+        limits.m_maxNodes = 10;
+
+        auto const result = search.Solve(state, limits);
+
+        EXPECT_EQ(result.m_result, EProofResult::Unknown);
+        EXPECT_LE(result.m_visitedNodesCnt, 10u + 9u);
+    }
+
+} // proof_number_search
+} // dma
+} // mimax_test
@@ -0,0 +1,184 @@
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "mimax/dma/MinimaxBase.h"
+#include "mimax/dma/Tablebase.h"
+#include "mimax/dma/TablebaseBuilder.h"
+
+#include "mimax_test/dma/MinimaxTicTacToeResolvers.h"
+#include "mimax_test/games/TicTacToeGame.h"
+
+namespace mimax_test {
+namespace dma {
+namespace tablebase {
+
+    using namespace mimax_test::dma::minimax;
+    using mimax::dma::CTablebase;
+    using mimax::dma::ETablebaseResult;
+    using mimax::dma::STablebaseEntry;
+
+    using CTicTacToeTablebaseBuilder = mimax::dma::CTablebaseBuilder<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CTablebaseMinimaxResolver>;
+    using CTicTacToeTablebaseMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CTablebaseMinimaxResolver, mimax::dma::SMinimaxDebugInfo>;
+
+    // covers only the states with at least 7 marks, so the searches store the nodes above them
+    class CPartialTablebaseMinimaxResolver : public CHashingMinimaxResolver
+    {
+    public:
+        using CHashingMinimaxResolver::CHashingMinimaxResolver;
+
+        bool GetTablebaseIndex(STicTacToeState const& state, size_t& indexOut)
+        {
+            size_t marksCnt = 0;
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int j = 0; j < 3; ++j)
+                {
+                    marksCnt += (state.m_map[i][j] != '-') ? 1 : 0;
+                }
+            }
+            return marksCnt >= 7 && CTablebaseMinimaxResolver(m_myPlayer).GetTablebaseIndex(state, indexOut);
+        }
+    };
+
+    static std::string GetTablebasePath()
+    {
+        return (std::filesystem::temp_directory_path() / "mimax_tic_tac_toe.mxtb").string();
+    }
+
+    static std::vector<uint16_t> BuildTicTacToeTablebase()
+    {
+        CTicTacToeTablebaseBuilder builder(CTablebaseMinimaxResolver('X'), CTablebaseMinimaxResolver::TABLEBASE_ENTRIES_COUNT);
+        return builder.Build({ { {"---", "---", "---"}, 'X' } });
+    }
+
+    static STablebaseEntry GetEntry(std::vector<uint16_t> const& entries, STicTacToeState const& state)
+    {
+        size_t index = 0;
+        CTablebaseMinimaxResolver('X').GetTablebaseIndex(state, index);
+        return STablebaseEntry::Decode(entries[index]);
+    }
+
+    GTEST_TEST(DmaCTablebaseBuilderTicTacToe, BuildEmptyStateIsDraw)
+    {
+        auto const entries = BuildTicTacToeTablebase();
+
+        EXPECT_EQ(GetEntry(entries, { {"---", "---", "---"}, 'X' }).m_result, ETablebaseResult::Draw);
+    }
+
+    GTEST_TEST(DmaCTablebaseBuilderTicTacToe, BuildWinningStateReturnsWinWithDistance)
+    {
+        auto const entries = BuildTicTacToeTablebase();
+
+        auto const entry = GetEntry(entries, { {"XX-", "OO-", "---"}, 'X' });
+
+        EXPECT_EQ(entry.m_result, ETablebaseResult::Win);
+        EXPECT_EQ(entry.m_distance, 1u);
+    }
+
+    GTEST_TEST(DmaCTablebaseBuilderTicTacToe, BuildLosingStateReturnsLossWithDistance)
+    {
+        auto const entries = BuildTicTacToeTablebase();
+
+        auto const entry = GetEntry(entries, { {"XX-", "-O-", "X-O"}, 'O' });
+
+        EXPECT_EQ(entry.m_result, ETablebaseResult::Loss);
+        EXPECT_EQ(entry.m_distance, 2u);
+    }
+
+    GTEST_TEST(DmaCTablebaseTicTacToe, OpenSavedTablebaseProbesSavedEntries)
+    {
+        auto const entries = BuildTicTacToeTablebase();
+        ASSERT_TRUE(CTablebase::Save(GetTablebasePath(), entries));
+        CTablebase tablebase;
+
+        ASSERT_TRUE(tablebase.Open(GetTablebasePath()));
+
+        EXPECT_EQ(tablebase.GetEntriesCount(), entries.size());
+        STablebaseEntry entry;
+        size_t index = 0;
+        CTablebaseMinimaxResolver('X').GetTablebaseIndex({ {"XX-", "OO-", "---"}, 'X' }, index);
+        ASSERT_TRUE(tablebase.Probe(index, entry));
+        EXPECT_EQ(entry.m_result, ETablebaseResult::Win);
+    }
+
+    GTEST_TEST(DmaCTablebaseTicTacToe, OpenMissingFileReturnsFalse)
+    {
+        CTablebase tablebase;
+
+        EXPECT_FALSE(tablebase.Open((std::filesystem::temp_directory_path() / "mimax_missing.mxtb").string()));
+        EXPECT_FALSE(tablebase.IsOpen());
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, PlayGameWithTablebaseSpecifiedStateReturnsWinnerX)
+    {
+        ASSERT_TRUE(CTablebase::Save(GetTablebasePath(), BuildTicTacToeTablebase()));
+        CTablebase tablebase;
+        ASSERT_TRUE(tablebase.Open(GetTablebasePath()));
+        auto const findNextMoveFunc = [&tablebase](STicTacToeState const& state) {
+            CTicTacToeTablebaseMinimax minimax(CTablebaseMinimaxResolver(state.m_player), CreateConfig<CTicTacToeTablebaseMinimax>());
+            minimax.SetTablebase(&tablebase);
+            auto const move = minimax.FindSolution(state).value();
+            EXPECT_EQ(minimax.GetDebugInfo().m_maxDepth, 1u);
+            return move;
+        };
+
+        auto const winner = mimax_test::games::tic_tac_toe::PlayGame({ {"X--", "-O-", "O-X"}, 'X' }, findNextMoveFunc);
+
+        EXPECT_EQ(winner, 'X');
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithTablebaseLosingStateReturnsScoreOfDistance)
+    {
+        ASSERT_TRUE(CTablebase::Save(GetTablebasePath(), BuildTicTacToeTablebase()));
+        CTablebase tablebase;
+        ASSERT_TRUE(tablebase.Open(GetTablebasePath()));
+        STicTacToeState const state = { {"XX-", "-O-", "X-O"}, 'O' };
+        auto const config = CreateConfig<CTicTacToeTablebaseMinimax>();
+        CTicTacToeTablebaseMinimax minimax(CTablebaseMinimaxResolver(state.m_player), config);
+        minimax.SetTablebase(&tablebase);
+
+        auto const result = minimax.Search(state);
+
+        // lost in 2 plies, every reply leaves a win in 1
+        EXPECT_FLOAT_EQ(result.m_score, config.m_minValue + 2.0f * config.m_epsilon);
+        EXPECT_GT(minimax.GetDebugInfo().m_tablebaseHitsCnt, 0u);
+    }
+
+    GTEST_TEST(DmaCMinimaxBaseTicTacToe, SearchWithTablebaseAndKeptSearchDataReturnsFreshSearchScores)
+    {
+        using CPartialTablebaseMinimax = mimax::dma::CMinimaxBase<STicTacToeState, STicTacToeMove, CTicTacToeMovesContainer, CPartialTablebaseMinimaxResolver>;
+        ASSERT_TRUE(CTablebase::Save(GetTablebasePath(), BuildTicTacToeTablebase()));
+        CTablebase tablebase;
+        ASSERT_TRUE(tablebase.Open(GetTablebasePath()));
+        STicTacToeState const grandparentState = { {"XO-", "---", "---"}, 'X' };
+        // the first grandchild, its children are stored two plies deeper by the grandparent search
+        STicTacToeState const state = { {"XOX", "O--", "---"}, 'X' };
+        auto config = CreateConfig<CPartialTablebaseMinimax>();
+        config.m_keepSearchData = true;
+        // every root move gets an exact score
+        config.m_multiPVCount = 9;
+        CPartialTablebaseMinimax minimax(CPartialTablebaseMinimaxResolver(state.m_player), config);
+        minimax.SetTablebase(&tablebase);
+        CPartialTablebaseMinimax freshMinimax(CPartialTablebaseMinimaxResolver(state.m_player), config);
+        freshMinimax.SetTablebase(&tablebase);
+        minimax.Search(grandparentState);
+        // not deeper than the grandparent search went below the state, so its entries are used
+        mimax::dma::SSearchLimits limits;
+        limits.m_maxDepth = config.m_maxDepth - 2;
+
+        auto const result = minimax.Search(state, limits);
+        auto const expectedResult = freshMinimax.Search(state, limits);
+
+        ASSERT_EQ(result.m_rootMoves.size(), expectedResult.m_rootMoves.size());
+        for (size_t i = 0; i < result.m_rootMoves.size(); ++i)
+        {
+            EXPECT_FLOAT_EQ(result.m_rootMoves[i].m_score, expectedResult.m_rootMoves[i].m_score) << "root move " << i;
+        }
+    }
+
+} // tablebase
+} // dma
+} // mimax_test
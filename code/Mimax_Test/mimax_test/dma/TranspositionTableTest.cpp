@@ -0,0 +1,112 @@
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "mimax/dma/TranspositionTable.h"
+
+namespace mimax_test {
+namespace dma {
+namespace transposition_table {
+
+using mimax::dma::ETranspositionBound;
+using CTestTranspositionTable = mimax::dma::CTranspositionTable<int>;
+
+GTEST_TEST(DmaCTranspositionTable, ResizeNotPowerOfTwoRoundsDown)
+{
+    CTestTranspositionTable table(100);
+
+    EXPECT_EQ(table.GetEntriesCount(), 16u * CTestTranspositionTable::BUCKET_SIZE);
+}
+
+GTEST_TEST(DmaCTranspositionTable, ProbeEmptyTableReturnsFalse)
+{
+    CTestTranspositionTable table(64);
+    CTestTranspositionTable::SEntry entry;
+
+    EXPECT_FALSE(table.Probe(42, entry));
+}
+
+GTEST_TEST(DmaCTranspositionTable, ProbeStoredHashReturnsStoredEntry)
+{
+    CTestTranspositionTable table(64);
+    int const move = 7;
+    CTestTranspositionTable::SEntry entry;
+
+    table.Store(42, 0.5f, 3, ETranspositionBound::Lower, &move);
+    bool const isFound = table.Probe(42, entry);
+
+    ASSERT_TRUE(isFound);
+    EXPECT_FLOAT_EQ(entry.m_score, 0.5f);
+    EXPECT_EQ(entry.m_depth, 3u);
+    EXPECT_EQ(entry.m_bound, ETranspositionBound::Lower);
+    EXPECT_TRUE(entry.m_hasMove);
+    EXPECT_EQ(entry.m_move, move);
+}
+
+GTEST_TEST(DmaCTranspositionTable, StoreFullBucketReplacesShallowestEntry)
+{
+    CTestTranspositionTable table(CTestTranspositionTable::BUCKET_SIZE);
+    for (size_t i = 0; i < CTestTranspositionTable::BUCKET_SIZE; ++i)
+    {
+        table.Store(i + 1, 0.0f, i + 1, ETranspositionBound::Exact, nullptr);
+    }
+    CTestTranspositionTable::SEntry entry;
+
+    bool const isCollision = table.Store(100, 0.0f, 10, ETranspositionBound::Exact, nullptr);
+
+    EXPECT_TRUE(isCollision);
+    EXPECT_FALSE(table.Probe(1, entry));
+    EXPECT_TRUE(table.Probe(2, entry));
+    EXPECT_TRUE(table.Probe(100, entry));
+}
+
+GTEST_TEST(DmaCTranspositionTable, ClearRemovesStoredEntries)
+{
+    CTestTranspositionTable table(64);
+    CTestTranspositionTable::SEntry entry;
+    table.Store(42, 0.5f, 3, ETranspositionBound::Exact, nullptr);
+
+    table.Clear();
+
+    EXPECT_FALSE(table.Probe(42, entry));
+}
+
+GTEST_TEST(DmaCTranspositionTable, StoreFullBucketAfterNextGenerationReplacesOldEntryFirst)
+{
+    CTestTranspositionTable table(CTestTranspositionTable::BUCKET_SIZE);
+    table.Store(1, 0.0f, 10, ETranspositionBound::Exact, nullptr);
+    table.NextGeneration();
+    for (size_t i = 1; i < CTestTranspositionTable::BUCKET_SIZE; ++i)
+    {
+        table.Store(i + 1, 0.0f, 1, ETranspositionBound::Exact, nullptr);
+    }
+    CTestTranspositionTable::SEntry entry;
+
+    table.Store(100, 0.0f, 1, ETranspositionBound::Exact, nullptr);
+
+    EXPECT_FALSE(table.Probe(1, entry));
+    EXPECT_TRUE(table.Probe(2, entry));
+    EXPECT_TRUE(table.Probe(100, entry));
+}
+
+GTEST_TEST(DmaCTranspositionTable, ProbeStoredPairMoveReturnsStoredMove)
+{
+    using CPairTranspositionTable = mimax::dma::CTranspositionTable<std::pair<int, int>>;
+    static_assert(mimax::dma::IsSharedTranspositionMove<std::pair<int, int>>);
+    static_assert(!mimax::dma::IsSharedTranspositionMove<std::string>);
+    CPairTranspositionTable table(64);
+    std::pair<int, int> const move = { 1, 2 };
+    CPairTranspositionTable::SEntry entry;
+
+    table.Store(42, 0.5f, 3, ETranspositionBound::Exact, &move);
+    bool const isFound = table.Probe(42, entry);
+
+    ASSERT_TRUE(isFound);
+    EXPECT_TRUE(entry.m_hasMove);
+    EXPECT_EQ(entry.m_move, move);
+}
+
+} // transposition_table
+} // dma
+} // mimax_test
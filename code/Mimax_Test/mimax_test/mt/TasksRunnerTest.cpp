@@ -98,6 +98,58 @@ GTEST_TEST(MtCTasksRunner, RunTasksAndWaitRun2TasksExpectNoHang)
     TasksRunner.RunTasksAndWait({ &taskMock1, &taskMock2 }, 0ms);
 }
 
+GTEST_TEST(MtCTasksRunner, RunTasksAsyncStopTasksExpectTaskIsCompletedProperly)
+{
+    testing::NiceMock<CTaskMock> taskMock;
+    taskMock.ExpectRunTaskIsCalledOnce();
+    taskMock.ExpectStopTaskIsCalledOnce();
+    CTasksRunner TasksRunner;
+
+    TasksRunner.RunTasksAsync({ &taskMock });
+    TasksRunner.StopTasks();
+    TasksRunner.WaitForTasksCompleted();
+
+    EXPECT_TRUE(taskMock.IsTaskCompletedProperly());
+}
+
+GTEST_TEST(MtCTasksRunner, RunTasksAndWaitFinishedTasksReturnsBeforeWaitingTime)
+{
+    testing::NiceMock<CTaskMock> taskMock;
+    ON_CALL(taskMock, RunTask())
+        .WillByDefault([]() {});
+    CTasksRunner TasksRunner;
+    auto const startTime = chrono::steady_clock::now();
+
+    TasksRunner.RunTasksAndWait({ &taskMock }, 10s);
+
+    EXPECT_LT(chrono::steady_clock::now() - startTime, 5s);
+}
+
+GTEST_TEST(MtCTasksRunner, RunTasksAndWaitFinishedTasksExpectStopTaskIsNotCalled)
+{
+    testing::NiceMock<CTaskMock> taskMock;
+    ON_CALL(taskMock, RunTask())
+        .WillByDefault([]() {});
+    EXPECT_CALL(taskMock, StopTask())
+        .Times(0);
+    CTasksRunner TasksRunner;
+
+    TasksRunner.RunTasksAndWait({ &taskMock }, 10s);
+}
+
+GTEST_TEST(MtCTasksRunner, RunTasksAndWaitExpectPrepareTaskIsCalledBeforeRunTask)
+{
+    testing::NiceMock<CTaskMock> taskMock;
+    testing::InSequence sequence;
+    EXPECT_CALL(taskMock, PrepareTask())
+        .Times(1);
+    EXPECT_CALL(taskMock, RunTask())
+        .WillOnce([]() {});
+    CTasksRunner TasksRunner;
+
+    TasksRunner.RunTasksAndWait({ &taskMock }, 10s);
+}
+
 } // tasks_manager
 } // mt
 } // mimax_test
\ No newline at end of file